@@ -0,0 +1,138 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <headers/variantx-atomic.hpp>
+#include <headers/variantx.hpp>
+#include <mutex>
+#include <thread>
+
+#include "../utils/harness.hpp"
+
+namespace
+{
+    namespace vx = variantx;
+
+    struct Idle
+    {
+    };
+
+    struct Running
+    {
+        std::uint64_t id;
+    };
+
+    struct Failed
+    {
+        std::int32_t code;
+    };
+
+    // 8 bytes with the index
+    using Small = vx::Variant<Idle, std::uint32_t, Failed>;
+
+    // 16 bytes with the index
+    using State = vx::Variant<Idle, Running, Failed>;
+
+    template <typename TVariant>
+    class Guarded
+    {
+    public:
+        explicit Guarded(const TVariant& value) : value_(value) {}
+
+        TVariant Load() const
+        {
+            const std::lock_guard lock(mutex_);
+            return value_;
+        }
+
+        void Store(const TVariant& value)
+        {
+            const std::lock_guard lock(mutex_);
+            value_ = value;
+        }
+
+    private:
+        mutable std::mutex mutex_;
+        TVariant           value_;
+    };
+
+    template <typename Shared, typename Make>
+    void PublishAndRead(bench_utils::Harness& harness, std::string_view distribution,
+                        std::string_view strategy, std::size_t size, Shared& shared, Make make)
+    {
+        harness.Run(distribution, strategy, size,
+                    [&]
+                    {
+                        std::size_t sum = 0;
+                        for (std::size_t i = 0; i < size; ++i)
+                        {
+                            shared.Store(make(i));
+                            sum += shared.Load().Index();
+                        }
+                        bench_utils::DoNotOptimize(sum);
+                    });
+    }
+
+    // A second thread reads the state all along the measurement
+    template <typename Shared, typename Body>
+    void WithReader(Shared& shared, Body body)
+    {
+        std::atomic<bool> stop = false;
+        std::thread       reader(
+            [&]
+            {
+                std::size_t sum = 0;
+                while (!stop.load(std::memory_order_relaxed))
+                {
+                    sum += shared.Load().Index();
+                }
+                bench_utils::DoNotOptimize(sum);
+            });
+
+        body();
+
+        stop.store(true, std::memory_order_relaxed);
+        reader.join();
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    constexpr std::size_t kDefaultSize = 1U << 20U;
+
+    const std::size_t size =
+        argc > 1 ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10))  // NOLINT
+                 : kDefaultSize;
+
+    bench_utils::Harness harness;
+    harness.PrintHeader("variantx shared state, Store + Load, per pair");
+
+    const auto make_small = [](std::size_t i) -> Small
+    { return static_cast<std::uint32_t>(i); };
+    const auto make_state = [](std::size_t i) -> State { return Running{i}; };
+
+    Guarded<Small>          guarded_small(Small{});
+    vx::AtomicVariant<Idle, std::uint32_t, Failed> atomic_small;
+    PublishAndRead(harness, "8 bytes", "mutex", size, guarded_small, make_small);
+    PublishAndRead(harness, "8 bytes", "AtomicVariant", size, atomic_small, make_small);
+
+    Guarded<State>                           guarded_state(State{});
+    vx::AtomicVariant<Idle, Running, Failed> atomic_state;
+    PublishAndRead(harness, "16 bytes", "mutex", size, guarded_state, make_state);
+    PublishAndRead(harness, "16 bytes", "AtomicVariant", size, atomic_state, make_state);
+
+    WithReader(guarded_state,
+               [&]
+               {
+                   PublishAndRead(harness, "16 bytes, reader", "mutex", size, guarded_state,
+                                  make_state);
+               });
+    WithReader(atomic_state,
+               [&]
+               {
+                   PublishAndRead(harness, "16 bytes, reader", "AtomicVariant", size,
+                                  atomic_state, make_state);
+               });
+
+    return 0;
+}
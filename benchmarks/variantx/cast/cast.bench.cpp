@@ -0,0 +1,192 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <expected>
+#include <headers/variantx.hpp>
+#include <random>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../utils/harness.hpp"
+
+namespace
+{
+    namespace vx = variantx;
+
+    struct A
+    {
+        std::int32_t value;
+    };
+
+    struct B
+    {
+        std::int64_t value;
+    };
+
+    struct C
+    {
+        double value;
+    };
+
+    struct D
+    {
+        std::uint16_t value;
+    };
+
+    struct E
+    {
+        float value;
+    };
+
+    struct F
+    {
+        std::uint64_t bits;
+    };
+
+    // Pipeline stage messages: the wide variant is a reordered superset of the narrow one
+    using Narrow = vx::Variant<A, B, C, D>;
+    using Wide   = vx::Variant<E, D, C, F, B, A>;
+
+    using NarrowResult = std::expected<Narrow, vx::AccessError>;
+
+    template <std::size_t Index>
+    auto MakeAlternative(std::int32_t value)
+    {
+        using T = vx::VariantAlternativeType<Index, Narrow>;
+        return T{static_cast<decltype(T::value)>(value)};
+    }
+
+    template <std::size_t... Indices>
+    Narrow MakeNarrow(std::size_t index, std::int32_t value, std::index_sequence<Indices...>)
+    {
+        Narrow result;
+        ((index == Indices ? (result.Emplace<Indices>(MakeAlternative<Indices>(value)), true)
+                           : false) ||
+         ...);
+        return result;
+    }
+
+    std::vector<Narrow> MakeWorkload(std::size_t size)
+    {
+        std::mt19937_64                            rng(0xC0FFEE);  // NOLINT -> fixed seed
+        std::uniform_int_distribution<std::size_t> pick(0, vx::kVariantSizeV<Narrow> - 1);
+
+        std::vector<Narrow> result;
+        result.reserve(size);
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            result.push_back(MakeNarrow(pick(rng), static_cast<std::int32_t>(rng() & 0xFFFFU),
+                                        std::make_index_sequence<vx::kVariantSizeV<Narrow>>()));
+        }
+
+        return result;
+    }
+
+    /*
+     * Widening
+     */
+
+    void WidenVisit(const std::vector<Narrow>& from, std::vector<Wide>& to)
+    {
+        for (std::size_t i = 0; i < from.size(); ++i)
+        {
+            // SelectorType resolution for the converting constructor + a dispatch
+            to[i] = vx::Visit([](const auto& value) { return Wide(value); }, from[i]);
+        }
+    }
+
+    void WidenCast(const std::vector<Narrow>& from, std::vector<Wide>& to)
+    {
+        for (std::size_t i = 0; i < from.size(); ++i)
+        {
+            to[i] = vx::VariantCast<Wide>(from[i]);
+        }
+    }
+
+    /*
+     * Narrowing, every other alternative of the wide variant is not in the narrow one
+     */
+
+    std::size_t NarrowVisit(const std::vector<Wide>& from, std::vector<NarrowResult>& to)
+    {
+        std::size_t failures = 0;
+        for (std::size_t i = 0; i < from.size(); ++i)
+        {
+            to[i] = vx::Visit(
+                [](const auto& value) -> NarrowResult
+                {
+                    if constexpr (std::is_constructible_v<Narrow, decltype(value)>)
+                    {
+                        return Narrow(value);
+                    }
+                    else
+                    {
+                        return std::unexpected(vx::AccessError::WrongAlternative);
+                    }
+                },
+                from[i]);
+            failures += to[i].has_value() ? 0 : 1;
+        }
+
+        return failures;
+    }
+
+    std::size_t NarrowCast(const std::vector<Wide>& from, std::vector<NarrowResult>& to)
+    {
+        std::size_t failures = 0;
+        for (std::size_t i = 0; i < from.size(); ++i)
+        {
+            to[i] = vx::VariantCast<Narrow>(from[i]);
+            failures += to[i].has_value() ? 0 : 1;
+        }
+
+        return failures;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    constexpr std::size_t kDefaultSize = 1U << 20U;
+
+    const std::size_t size =
+        argc > 1 ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10))  // NOLINT
+                 : kDefaultSize;
+
+    bench_utils::Harness harness;
+    harness.PrintHeader("variantx cast, 4 <-> 6 alternatives, per element");
+
+    const std::vector<Narrow> narrow = MakeWorkload(size);
+
+    std::vector<Wide> wide(size);
+    harness.Run("widening", "Visit + converting", size,
+                [&]
+                {
+                    WidenVisit(narrow, wide);
+                    bench_utils::DoNotOptimize(wide.data());
+                });
+
+    harness.Run("widening", "VariantCast", size,
+                [&]
+                {
+                    WidenCast(narrow, wide);
+                    bench_utils::DoNotOptimize(wide.data());
+                });
+
+    // Half of the source can not be narrowed
+    for (std::size_t i = 0; i < size; i += 2)
+    {
+        wide[i] = Wide(F{i});
+    }
+
+    std::vector<NarrowResult> results(size);
+    harness.Run("narrowing", "Visit + converting", size,
+                [&] { bench_utils::DoNotOptimize(NarrowVisit(wide, results)); });
+
+    harness.Run("narrowing", "VariantCast", size,
+                [&] { bench_utils::DoNotOptimize(NarrowCast(wide, results)); });
+
+    return 0;
+}
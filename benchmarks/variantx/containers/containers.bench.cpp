@@ -0,0 +1,178 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <headers/variantx-collection.hpp>
+#include <headers/variantx-index-array.hpp>
+#include <headers/variantx-packed-buffer.hpp>
+#include <headers/variantx-vector.hpp>
+#include <headers/variantx.hpp>
+#include <random>
+#include <vector>
+
+#include "../utils/harness.hpp"
+
+namespace
+{
+    namespace vx = variantx;
+
+    // Simulation entities of very different sizes, most of them small
+    struct Particle
+    {
+        float x;
+        float velocity;
+    };
+
+    struct Projectile
+    {
+        double x;
+        double velocity;
+        double drag;
+    };
+
+    struct Body
+    {
+        double x;
+        double velocity;
+        double inertia[14];  // NOLINT -> c-style array
+    };
+
+    constexpr double kStep = 0.016;
+
+    struct Update
+    {
+        void operator()(Particle& particle) const noexcept
+        {
+            particle.x += particle.velocity * static_cast<float>(kStep);
+        }
+
+        void operator()(Projectile& projectile) const noexcept
+        {
+            projectile.velocity -= projectile.drag * kStep;
+            projectile.x += projectile.velocity * kStep;
+        }
+
+        void operator()(Body& body) const noexcept
+        {
+            body.x += body.velocity * kStep / body.inertia[0];
+        }
+    };
+
+    using Entity = vx::Variant<Particle, Projectile, Body>;
+
+    // 80% particles, 15% projectiles, 5% bodies, shuffled
+    std::vector<Entity> MakeWorkload(std::size_t size)
+    {
+        std::mt19937_64                            rng(0xC0FFEE);  // NOLINT -> fixed seed
+        std::uniform_int_distribution<std::size_t> pick(0, 99);  // NOLINT
+
+        std::vector<Entity> result;
+        result.reserve(size);
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            const std::size_t roll = pick(rng);
+            if (roll < 80)  // NOLINT
+            {
+                result.emplace_back(Particle{0.0F, 1.0F});
+            }
+            else if (roll < 95)  // NOLINT
+            {
+                result.emplace_back(Projectile{0.0, 10.0, 0.1});
+            }
+            else
+            {
+                result.emplace_back(Body{0.0, 1.0, {2.0}});
+            }
+        }
+
+        return result;
+    }
+
+    template <typename Container>
+    Container Fill(const std::vector<Entity>& entities)
+    {
+        Container container;
+        for (const Entity& entity : entities)
+        {
+            container.PushBack(entity);
+        }
+        return container;
+    }
+
+    vx::VariantCollection<Particle, Projectile, Body> FillCollection(
+        const std::vector<Entity>& entities)
+    {
+        vx::VariantCollection<Particle, Projectile, Body> collection;
+        for (const Entity& entity : entities)
+        {
+            collection.Insert(entity);
+        }
+        return collection;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    constexpr std::size_t kDefaultSize = 1U << 20U;
+
+    const std::size_t size =
+        argc > 1 ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10))  // NOLINT
+                 : kDefaultSize;
+
+    bench_utils::Harness harness;
+    harness.PrintHeader("variantx containers, update of 3 entity types, per element");
+
+    std::vector<Entity> entities = MakeWorkload(size);
+
+    auto vector     = Fill<vx::VariantVector<Particle, Projectile, Body>>(entities);
+    auto buffer     = Fill<vx::PackedVariantBuffer<Particle, Projectile, Body>>(entities);
+    auto collection = FillCollection(entities);
+
+    harness.Run("80/15/5", "Visit per element", size,
+                [&]
+                {
+                    for (Entity& entity : entities)
+                    {
+                        vx::Visit(Update(), entity);
+                    }
+                    bench_utils::DoNotOptimize(entities.data());
+                });
+
+    harness.Run("80/15/5", "PackedVariantBuffer", size,
+                [&]
+                {
+                    buffer.VisitAll(Update());
+                    bench_utils::DoNotOptimize(buffer.SizeBytes());
+                });
+
+    harness.Run("80/15/5", "VariantVector", size,
+                [&]
+                {
+                    vector.VisitAll(Update());
+                    bench_utils::DoNotOptimize(vector.Size());
+                });
+
+    harness.Run("80/15/5", "VariantCollection", size,
+                [&]
+                {
+                    collection.ForEach(Update());
+                    bench_utils::DoNotOptimize(collection.Size());
+                });
+
+    // Counting bodies: a byte-sized index per element against 2 packed bits
+    harness.Run("80/15/5", "count, Index()", size,
+                [&]
+                {
+                    std::size_t count = 0;
+                    for (const Entity& entity : entities)
+                    {
+                        count += entity.Index() == 2 ? 1 : 0;
+                    }
+                    bench_utils::DoNotOptimize(count);
+                });
+
+    harness.Run("80/15/5", "count, PackedIndexArray", size,
+                [&] { bench_utils::DoNotOptimize(vector.Indices().CountAlternative<2>()); });
+
+    return 0;
+}
@@ -0,0 +1,244 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <headers/variantx.hpp>
+#include <random>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../utils/harness.hpp"
+
+namespace
+{
+    namespace vx = variantx;
+
+    // Alternatives do a little bit of different work, so the compiler can not merge the
+    // branches of the visitor into a single one.
+    struct A
+    {
+        std::int32_t value;
+    };
+
+    struct B
+    {
+        std::int64_t value;
+    };
+
+    struct C
+    {
+        double value;
+    };
+
+    struct D
+    {
+        std::uint16_t lo;
+        std::uint16_t hi;
+    };
+
+    struct E
+    {
+        float value;
+    };
+
+    struct F
+    {
+        std::uint8_t bytes[12];  // NOLINT -> c-style array
+    };
+
+    struct G
+    {
+        std::int32_t x;
+        std::int32_t y;
+    };
+
+    struct H
+    {
+        std::uint64_t bits;
+    };
+
+    using V = vx::Variant<A, B, C, D, E, F, G, H>;
+
+    struct Work
+    {
+        std::int64_t operator()(const A& a) const noexcept { return a.value; }
+        std::int64_t operator()(const B& b) const noexcept { return b.value * 3; }
+        std::int64_t operator()(const C& c) const noexcept
+        {
+            return static_cast<std::int64_t>(c.value);
+        }
+        std::int64_t operator()(const D& d) const noexcept { return d.lo ^ d.hi; }
+        std::int64_t operator()(const E& e) const noexcept
+        {
+            return static_cast<std::int64_t>(e.value * 2.0F);
+        }
+        std::int64_t operator()(const F& f) const noexcept { return f.bytes[0] + f.bytes[11]; }
+        std::int64_t operator()(const G& g) const noexcept { return g.x - g.y; }
+        std::int64_t operator()(const H& h) const noexcept
+        {
+            return static_cast<std::int64_t>(h.bits >> 3U);
+        }
+    };
+
+    template <std::size_t Index>
+    V MakeAlternative(std::mt19937_64& rng)
+    {
+        const auto value = static_cast<std::int32_t>(rng() & 0xFFFFU);
+
+        using T = vx::VariantAlternativeType<Index, V>;
+        if constexpr (std::is_same_v<T, A>)
+        {
+            return V(std::in_place_index<Index>, A{value});
+        }
+        else if constexpr (std::is_same_v<T, B>)
+        {
+            return V(std::in_place_index<Index>, B{value});
+        }
+        else if constexpr (std::is_same_v<T, C>)
+        {
+            return V(std::in_place_index<Index>, C{static_cast<double>(value)});
+        }
+        else if constexpr (std::is_same_v<T, D>)
+        {
+            return V(std::in_place_index<Index>, D{static_cast<std::uint16_t>(value), 7});
+        }
+        else if constexpr (std::is_same_v<T, E>)
+        {
+            return V(std::in_place_index<Index>, E{static_cast<float>(value)});
+        }
+        else if constexpr (std::is_same_v<T, F>)
+        {
+            return V(std::in_place_index<Index>, F{{static_cast<std::uint8_t>(value)}});
+        }
+        else if constexpr (std::is_same_v<T, G>)
+        {
+            return V(std::in_place_index<Index>, G{value, value / 2});
+        }
+        else
+        {
+            return V(std::in_place_index<Index>, H{static_cast<std::uint64_t>(value)});
+        }
+    }
+
+    template <std::size_t... Indices>
+    V MakeVariant(std::size_t index, std::mt19937_64& rng, std::index_sequence<Indices...>)
+    {
+        V result;
+        ((index == Indices ? (result = MakeAlternative<Indices>(rng), true) : false) || ...);
+        return result;
+    }
+
+    std::vector<V> MakeWorkload(std::size_t size, bool sorted)
+    {
+        std::mt19937_64                            rng(0xC0FFEE);  // NOLINT -> fixed seed
+        std::uniform_int_distribution<std::size_t> pick(0, vx::kVariantSizeV<V> - 1);
+
+        std::vector<V> result;
+        result.reserve(size);
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            result.push_back(
+                MakeVariant(pick(rng), rng, std::make_index_sequence<vx::kVariantSizeV<V>>()));
+        }
+
+        if (sorted)
+        {
+            std::ranges::stable_sort(result, {}, [](const V& v) { return v.Index(); });
+        }
+
+        return result;
+    }
+
+    /*
+     * Dispatch strategies
+     */
+
+    std::int64_t VisitTable(const std::vector<V>& variants)
+    {
+        std::int64_t sum = 0;
+        for (const auto& variant : variants)
+        {
+            sum += vx::Visit(Work{}, variant);
+        }
+
+        return sum;
+    }
+
+    template <std::size_t... Indices>
+    std::int64_t SwitchOne(const V& variant, std::index_sequence<Indices...>)
+    {
+        std::int64_t result = 0;
+        // Folded into a chain of compares, which the compiler usually lowers into a jump table
+        ((variant.Index() == Indices ? (result = Work{}(vx::Get<Indices>(variant)), true)
+                                     : false) ||
+         ...);
+        return result;
+    }
+
+    std::int64_t IndexSwitch(const std::vector<V>& variants)
+    {
+        std::int64_t sum = 0;
+        for (const auto& variant : variants)
+        {
+            sum += SwitchOne(variant, std::make_index_sequence<vx::kVariantSizeV<V>>());
+        }
+
+        return sum;
+    }
+
+    template <std::size_t... Indices>
+    std::int64_t GetIfOne(const V& variant, std::index_sequence<Indices...>)
+    {
+        std::int64_t result = 0;
+        ((vx::GetIf<Indices>(&variant) != nullptr
+              ? (result = Work{}(*vx::GetIf<Indices>(&variant)), true)
+              : false) ||
+         ...);
+        return result;
+    }
+
+    std::int64_t GetIfChain(const std::vector<V>& variants)
+    {
+        std::int64_t sum = 0;
+        for (const auto& variant : variants)
+        {
+            sum += GetIfOne(variant, std::make_index_sequence<vx::kVariantSizeV<V>>());
+        }
+
+        return sum;
+    }
+
+    void RunAll(bench_utils::Harness& harness, std::string_view distribution,
+                const std::vector<V>& variants)
+    {
+        const std::size_t size = variants.size();
+
+        harness.Run(distribution, "Visit (table)", size,
+                    [&] { bench_utils::DoNotOptimize(VisitTable(variants)); });
+
+        harness.Run(distribution, "Index() switch", size,
+                    [&] { bench_utils::DoNotOptimize(IndexSwitch(variants)); });
+
+        harness.Run(distribution, "GetIf chain", size,
+                    [&] { bench_utils::DoNotOptimize(GetIfChain(variants)); });
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    constexpr std::size_t kDefaultSize = 1U << 20U;
+
+    const std::size_t size =
+        argc > 1 ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10))  // NOLINT
+                 : kDefaultSize;
+
+    bench_utils::Harness harness;
+    harness.PrintHeader("variantx dispatch, 8 alternatives, per element");
+
+    RunAll(harness, "sorted", MakeWorkload(size, true));
+    RunAll(harness, "randomized", MakeWorkload(size, false));
+
+    return 0;
+}
@@ -0,0 +1,184 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <headers/variantx.hpp>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../utils/harness.hpp"
+
+namespace
+{
+    namespace vx = variantx;
+
+    /*
+     * The same JSON-like tree twice: arrays boxed with a per-node `new` (std::unique_ptr) and
+     * boxed with Recursive<T> in an Arena. Leaves are null, bool or number.
+     */
+
+    struct HeapJson;
+
+    struct HeapArray
+    {
+        std::vector<HeapJson> items;
+    };
+
+    struct HeapJson : vx::Variant<std::nullptr_t, bool, double, std::unique_ptr<HeapArray>>
+    {
+        using Variant::Variant;
+    };
+
+    struct ArenaJson;
+
+    struct ArenaArray
+    {
+        ArenaJson*  items;
+        std::size_t size;
+    };
+
+    struct ArenaJson : vx::Variant<std::nullptr_t, bool, double, vx::Recursive<ArenaArray>>
+    {
+        using Variant::Variant;
+    };
+
+    // Whole tree is trivially destructible: the arena frees chunks only
+    static_assert(std::is_trivially_destructible_v<ArenaJson>);
+
+    struct Shape
+    {
+        std::size_t depth;
+        std::size_t fanout;
+    };
+
+    template <typename Json>
+    Json MakeLeaf(std::size_t seed)
+    {
+        switch (seed % 3)
+        {
+            case 0:
+                return Json(nullptr);
+            case 1:
+                return Json(seed % 2 == 0);
+            default:
+                return Json(static_cast<double>(seed));
+        }
+    }
+
+    HeapJson BuildHeap(Shape shape, std::size_t seed)
+    {
+        if (shape.depth == 0)
+        {
+            return MakeLeaf<HeapJson>(seed);
+        }
+
+        auto array = std::make_unique<HeapArray>();
+        array->items.reserve(shape.fanout);
+        for (std::size_t i = 0; i < shape.fanout; ++i)
+        {
+            array->items.push_back(
+                BuildHeap({shape.depth - 1, shape.fanout}, seed * shape.fanout + i));
+        }
+
+        return HeapJson(std::move(array));
+    }
+
+    ArenaJson BuildArena(vx::Arena& arena, Shape shape, std::size_t seed)
+    {
+        if (shape.depth == 0)
+        {
+            return MakeLeaf<ArenaJson>(seed);
+        }
+
+        vx::Recursive<ArenaArray> array(arena, arena.CreateArray<ArenaJson>(shape.fanout),
+                                        shape.fanout);
+        for (std::size_t i = 0; i < shape.fanout; ++i)
+        {
+            array->items[i] =  // NOLINT -> pointer arithmetic
+                BuildArena(arena, {shape.depth - 1, shape.fanout}, seed * shape.fanout + i);
+        }
+
+        return ArenaJson(array);
+    }
+
+    struct Sum
+    {
+        double operator()(std::nullptr_t) const noexcept { return 0.0; }
+        double operator()(bool value) const noexcept { return value ? 1.0 : 0.0; }
+        double operator()(double value) const noexcept { return value; }
+
+        double operator()(const std::unique_ptr<HeapArray>& array) const
+        {
+            double result = 0.0;
+            for (const auto& item : array->items)
+            {
+                result += vx::Visit(*this, item);
+            }
+            return result;
+        }
+
+        // Visit passes the node, not the box
+        double operator()(const ArenaArray& array) const
+        {
+            double result = 0.0;
+            for (std::size_t i = 0; i < array.size; ++i)
+            {
+                result += vx::Visit(*this, array.items[i]);  // NOLINT -> pointer arithmetic
+            }
+            return result;
+        }
+    };
+
+    std::size_t CountNodes(Shape shape)
+    {
+        std::size_t nodes = 1;
+        std::size_t level = 1;
+        for (std::size_t i = 0; i < shape.depth; ++i)
+        {
+            level *= shape.fanout;
+            nodes += level;
+        }
+        return nodes;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    constexpr std::size_t kDefaultDepth = 6;
+
+    const std::size_t depth =
+        argc > 1 ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10))  // NOLINT
+                 : kDefaultDepth;
+
+    const Shape       shape{depth, 8};
+    const std::size_t nodes = CountNodes(shape);
+
+    bench_utils::Harness harness;
+    harness.PrintHeader("variantx recursive JSON tree, fanout 8, per node");
+
+    harness.Run("build + free", "per-node new", nodes,
+                [&]
+                {
+                    const HeapJson tree = BuildHeap(shape, 1);
+                    bench_utils::DoNotOptimize(tree.Index());
+                });
+
+    harness.Run("build + free", "Recursive + Arena", nodes,
+                [&]
+                {
+                    vx::Arena       arena;
+                    const ArenaJson tree = BuildArena(arena, shape, 1);
+                    bench_utils::DoNotOptimize(tree.Index());
+                });
+
+    const HeapJson heap_tree = BuildHeap(shape, 1);
+    harness.Run("traverse", "per-node new", nodes,
+                [&] { bench_utils::DoNotOptimize(vx::Visit(Sum{}, heap_tree)); });
+
+    vx::Arena       arena;
+    const ArenaJson arena_tree = BuildArena(arena, shape, 1);
+    harness.Run("traverse", "Recursive + Arena", nodes,
+                [&] { bench_utils::DoNotOptimize(vx::Visit(Sum{}, arena_tree)); });
+
+    return 0;
+}
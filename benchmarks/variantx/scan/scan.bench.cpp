@@ -0,0 +1,124 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <headers/variantx-scan.hpp>
+#include <headers/variantx.hpp>
+#include <random>
+#include <vector>
+
+#include "../utils/harness.hpp"
+
+namespace
+{
+    namespace vx = variantx;
+
+    struct Trade
+    {
+        std::uint64_t id;
+        double        price;
+        double        quantity;
+    };
+
+    struct Quote
+    {
+        std::uint64_t id;
+        double        bid;
+        double        ask;
+    };
+
+    struct Heartbeat
+    {
+        std::uint64_t id;
+    };
+
+    using Event = vx::Variant<Trade, Quote, Heartbeat>;
+
+    std::vector<Event> MakeWorkload(std::size_t size)
+    {
+        std::mt19937_64                            rng(0xC0FFEE);  // NOLINT -> fixed seed
+        std::uniform_int_distribution<std::size_t> pick(0, 2);
+
+        std::vector<Event> result;
+        result.reserve(size);
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            switch (pick(rng))
+            {
+                case 0:
+                    result.emplace_back(Trade{i, 1.0, 2.0});
+                    break;
+                case 1:
+                    result.emplace_back(Quote{i, 1.0, 2.0});
+                    break;
+                default:
+                    result.emplace_back(Heartbeat{i});
+                    break;
+            }
+        }
+
+        return result;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    constexpr std::size_t kDefaultSize = 1U << 22U;
+
+    const std::size_t size =
+        argc > 1 ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10))  // NOLINT
+                 : kDefaultSize;
+
+    bench_utils::Harness harness;
+    harness.PrintHeader("variantx scans over std::vector<Variant>, 3 alternatives, per element");
+
+    const std::vector<Event> events = MakeWorkload(size);
+
+    harness.Run("uniform", "count, Index()", size,
+                [&]
+                {
+                    std::size_t count = 0;
+                    for (const Event& event : events)
+                    {
+                        count += event.Index() == 0 ? 1 : 0;
+                    }
+                    bench_utils::DoNotOptimize(count);
+                });
+
+    harness.Run("uniform", "CountAlternative", size,
+                [&] { bench_utils::DoNotOptimize(vx::CountAlternative<Trade>(events)); });
+
+    harness.Run("uniform", "histogram, Index()", size,
+                [&]
+                {
+                    std::array<std::size_t, 3> histogram{};
+                    for (const Event& event : events)
+                    {
+                        ++histogram[event.Index()];
+                    }
+                    bench_utils::DoNotOptimize(histogram);
+                });
+
+    harness.Run("uniform", "IndexHistogram", size,
+                [&] { bench_utils::DoNotOptimize(vx::IndexHistogram(events)); });
+
+    harness.Run("uniform", "positions, Index()", size,
+                [&]
+                {
+                    std::vector<std::size_t> positions;
+                    for (std::size_t i = 0; i < events.size(); ++i)
+                    {
+                        if (events[i].Index() == 1)
+                        {
+                            positions.push_back(i);
+                        }
+                    }
+                    bench_utils::DoNotOptimize(positions.data());
+                });
+
+    harness.Run("uniform", "PositionsOf", size,
+                [&] { bench_utils::DoNotOptimize(vx::PositionsOf<Quote>(events).data()); });
+
+    return 0;
+}
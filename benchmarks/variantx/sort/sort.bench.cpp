@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <headers/variantx-sort.hpp>
+#include <headers/variantx.hpp>
+#include <random>
+#include <vector>
+
+#include "../utils/harness.hpp"
+
+namespace
+{
+    namespace vx = variantx;
+
+    using Key = vx::Variant<std::int32_t, std::int64_t, double, std::uint16_t>;
+
+    std::vector<Key> MakeWorkload(std::size_t size)
+    {
+        std::mt19937_64                              rng(0xC0FFEE);  // NOLINT -> fixed seed
+        std::uniform_int_distribution<std::uint16_t> value;
+
+        std::vector<Key> result;
+        result.reserve(size);
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            const std::uint16_t random = value(rng);
+            switch (random % 4)
+            {
+                case 0:
+                    result.emplace_back(static_cast<std::int32_t>(random));
+                    break;
+                case 1:
+                    result.emplace_back(static_cast<std::int64_t>(random));
+                    break;
+                case 2:
+                    result.emplace_back(static_cast<double>(random));
+                    break;
+                default:
+                    result.emplace_back(random);
+                    break;
+            }
+        }
+
+        return result;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    constexpr std::size_t kDefaultSize = 1U << 20U;
+
+    const std::size_t size =
+        argc > 1 ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10))  // NOLINT
+                 : kDefaultSize;
+
+    bench_utils::Harness harness;
+    harness.PrintHeader("variantx sort, 4 alternatives, per element");
+
+    const std::vector<Key> workload = MakeWorkload(size);
+    std::vector<Key>       keys;
+
+    // Every run sorts a fresh copy, the copy is timed too
+    harness.Run("uniform", "std::sort", size,
+                [&]
+                {
+                    keys = workload;
+                    std::sort(keys.begin(), keys.end());
+                    bench_utils::DoNotOptimize(keys.data());
+                });
+
+    harness.Run("uniform", "Sort", size,
+                [&]
+                {
+                    keys = workload;
+                    vx::Sort(keys);
+                    bench_utils::DoNotOptimize(keys.data());
+                });
+
+    harness.Run("uniform", "std::stable_partition", size,
+                [&]
+                {
+                    keys = workload;
+                    for (std::size_t index = 0; index + 1 < vx::kVariantSizeV<Key>; ++index)
+                    {
+                        std::stable_partition(keys.begin(), keys.end(), [index](const Key& key)
+                                              { return key.Index() <= index; });
+                    }
+                    bench_utils::DoNotOptimize(keys.data());
+                });
+
+    harness.Run("uniform", "StablePartitionByIndex", size,
+                [&]
+                {
+                    keys = workload;
+                    bench_utils::DoNotOptimize(vx::StablePartitionByIndex(keys));
+                });
+
+    harness.Run("uniform", "SortByIndex", size,
+                [&]
+                {
+                    keys = workload;
+                    bench_utils::DoNotOptimize(vx::SortByIndex(keys));
+                });
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string_view>
+
+#include "perf-counters.hpp"
+
+namespace bench_utils
+{
+    template <typename T>
+    inline void DoNotOptimize(const T& value)
+    {
+        asm volatile("" : : "r,m"(value) : "memory");  // NOLINT -> inline asm
+    }
+
+    class Harness
+    {
+    public:
+        explicit Harness(std::size_t repetitions = 5) : repetitions_(repetitions) {}
+
+        void PrintHeader(std::string_view title) const
+        {
+            std::printf("\n%.*s\n", static_cast<int>(title.size()), title.data());
+
+            if (!counters_.AnyAvailable())
+            {
+                std::printf("(hardware counters are not permitted here, reporting time only)\n");
+            }
+
+            std::printf("%-14s %-22s %10s", "distribution", "strategy", "ns/elem");
+            for (std::size_t i = 0; i < kPerfEventCount; ++i)
+            {
+                const auto name = PerfEventName(static_cast<PerfEvent>(i));
+                std::printf(" %15.*s", static_cast<int>(name.size()), name.data());
+            }
+            std::printf("\n");
+        }
+
+        /*
+         * Runs `body` `repetitions_` times and reports the best run normalized per element.
+         * The best run (not the mean) is used, it is the least disturbed by the scheduler.
+         */
+        template <typename Body>
+        void Run(std::string_view distribution, std::string_view strategy, std::size_t elements,
+                 Body&& body)
+        {
+            double                best_ns       = 0.0;
+            PerfCounters::Result best_counters = {};
+
+            for (std::size_t i = 0; i < repetitions_; ++i)
+            {
+                const auto start = std::chrono::steady_clock::now();
+                counters_.Start();
+
+                body();
+
+                auto       counters = counters_.Stop();
+                const auto finish   = std::chrono::steady_clock::now();
+
+                const double ns =
+                    std::chrono::duration<double, std::nano>(finish - start).count();
+                if (i == 0 || ns < best_ns)
+                {
+                    best_ns       = ns;
+                    best_counters = counters;
+                }
+            }
+
+            const auto per_elem = [elements](double value)
+            { return value / static_cast<double>(std::max<std::size_t>(elements, 1)); };
+
+            std::printf("%-14.*s %-22.*s %10.3f", static_cast<int>(distribution.size()),
+                        distribution.data(), static_cast<int>(strategy.size()), strategy.data(),
+                        per_elem(best_ns));
+
+            for (const auto& counter : best_counters)
+            {
+                if (counter.has_value())
+                {
+                    std::printf(" %15.4f", per_elem(static_cast<double>(*counter)));
+                }
+                else
+                {
+                    std::printf(" %15s", "n/a");
+                }
+            }
+            std::printf("\n");
+        }
+
+    private:
+        std::size_t  repetitions_;
+        PerfCounters counters_;
+    };
+}  // namespace bench_utils
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#if defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace bench_utils
+{
+    // Hardware events we care about for dispatch-heavy code.
+    // Order matters, it is used as an index into PerfCounters::Result.
+    enum class PerfEvent : std::uint8_t
+    {
+        Instructions  = 0,
+        BranchMisses  = 1,
+        L1iReadMisses = 2
+    };
+
+    inline constexpr std::size_t kPerfEventCount = 3;
+
+    constexpr std::string_view PerfEventName(PerfEvent event) noexcept
+    {
+        switch (event)
+        {
+            case PerfEvent::Instructions:
+                return "instructions";
+            case PerfEvent::BranchMisses:
+                return "branch-misses";
+            case PerfEvent::L1iReadMisses:
+                return "L1i-misses";
+        }
+
+        return "unknown";
+    }
+
+    class PerfCounters
+    {
+    public:
+        using Result = std::array<std::optional<std::uint64_t>, kPerfEventCount>;
+
+        PerfCounters()
+        {
+            /*
+             * Every event is opened separately: in unprivileged containers (or on VMs without
+             * PMU passthrough) some or all of them are not available, in that case the
+             * corresponding descriptor stays -1 and the event is reported as missing.
+             */
+            for (std::size_t i = 0; i < kPerfEventCount; ++i)
+            {
+                fds_[i] = Open(static_cast<PerfEvent>(i));
+            }
+        }
+
+        PerfCounters(const PerfCounters&)            = delete;
+        PerfCounters(PerfCounters&&)                 = delete;
+        PerfCounters& operator=(const PerfCounters&) = delete;
+        PerfCounters& operator=(PerfCounters&&)      = delete;
+
+        ~PerfCounters()
+        {
+#if defined(__linux__)
+            for (int fd : fds_)
+            {
+                if (fd != -1)
+                {
+                    close(fd);
+                }
+            }
+#endif
+        }
+
+        bool Available(PerfEvent event) const noexcept
+        {
+            return fds_[static_cast<std::size_t>(event)] != -1;
+        }
+
+        bool AnyAvailable() const noexcept
+        {
+            for (int fd : fds_)
+            {
+                if (fd != -1)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        void Start() noexcept
+        {
+#if defined(__linux__)
+            for (int fd : fds_)
+            {
+                if (fd != -1)
+                {
+                    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+                }
+            }
+#endif
+        }
+
+        Result Stop() noexcept
+        {
+            Result result = {};
+
+#if defined(__linux__)
+            for (int fd : fds_)
+            {
+                if (fd != -1)
+                {
+                    ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+                }
+            }
+
+            for (std::size_t i = 0; i < kPerfEventCount; ++i)
+            {
+                std::uint64_t value = 0;
+                if (fds_[i] != -1 && read(fds_[i], &value, sizeof(value)) == sizeof(value))
+                {
+                    result[i] = value;
+                }
+            }
+#endif
+
+            return result;
+        }
+
+    private:
+        static int Open([[maybe_unused]] PerfEvent event) noexcept
+        {
+#if defined(__linux__)
+            perf_event_attr attr = {};
+
+            attr.size           = sizeof(attr);
+            attr.disabled       = 1;
+            attr.exclude_kernel = 1;  // allowed with perf_event_paranoid <= 2
+            attr.exclude_hv     = 1;
+
+            switch (event)
+            {
+                case PerfEvent::Instructions:
+                    attr.type   = PERF_TYPE_HARDWARE;
+                    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+                    break;
+                case PerfEvent::BranchMisses:
+                    attr.type   = PERF_TYPE_HARDWARE;
+                    attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+                    break;
+                case PerfEvent::L1iReadMisses:
+                    attr.type   = PERF_TYPE_HW_CACHE;
+                    attr.config = PERF_COUNT_HW_CACHE_L1I |
+                                  (PERF_COUNT_HW_CACHE_OP_READ << 8U) |
+                                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16U);
+                    break;
+            }
+
+            // pid == 0, cpu == -1 -> this thread on any cpu
+            // NOLINTNEXTLINE -> vararg call
+            const long fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+            return fd < 0 ? -1 : static_cast<int>(fd);
+#else
+            return -1;
+#endif
+        }
+
+        std::array<int, kPerfEventCount> fds_ = {};
+    };
+}  // namespace bench_utils
@@ -0,0 +1,7 @@
+function (create_benchmark name)
+    file(GLOB_RECURSE BENCHMARKS ${CMAKE_CURRENT_SOURCE_DIR}/*bench.cpp)
+    add_executable(${name} ${BENCHMARKS})
+
+    target_include_directories(${name} PRIVATE ${CMAKE_SOURCE_DIR})
+    target_compile_options(${name} PRIVATE -O2)
+endfunction()
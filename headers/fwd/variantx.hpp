@@ -8,6 +8,30 @@ namespace variantx
     template <typename... Ts>
     class Variant;
 
+    template <typename... Ts>
+    class VariantRef;
+
+    template <typename... Ts>
+    class VariantVector;
+
+    template <typename... Ts>
+    class PackedVariantBuffer;
+
+    template <typename... Ts>
+    class VariantCollection;
+
+    template <std::size_t Alternatives>
+    class PackedIndexArray;
+
+    template <typename... Ts>
+    class AtomicVariant;
+
+    namespace pmr
+    {
+        template <typename... Ts>
+        class Variant;
+    }  // namespace pmr
+
     template <typename T>
     struct VariantSize;
 
@@ -20,6 +44,17 @@ namespace variantx
     template <std::size_t Index, typename T>
     using VariantAlternativeType = typename VariantAlternative<Index, T>::Type;
 
+    template <typename T>
+    struct ReuseStorage;
+
+    struct Monostate;
+
+    template <typename T>
+    struct FlattenVariant;
+
+    template <typename T>
+    using FlattenVariantType = typename FlattenVariant<T>::Type;
+
     inline constexpr std::size_t kVariantNpos = std::numeric_limits<std::size_t>::max();
 
     template <std::size_t Index, typename... Ts>
@@ -48,6 +83,34 @@ namespace variantx
     template <typename T, typename... Ts>
     constexpr const T&& Get(const Variant<Ts...>&& variant);
 
+    template <std::size_t Index, typename... Ts>
+    constexpr VariantAlternativeType<Index, Variant<Ts...>>& GetUnchecked(
+        Variant<Ts...>& variant) noexcept;
+
+    template <std::size_t Index, typename... Ts>
+    constexpr VariantAlternativeType<Index, Variant<Ts...>>&& GetUnchecked(
+        Variant<Ts...>&& variant) noexcept;
+
+    template <std::size_t Index, typename... Ts>
+    constexpr const VariantAlternativeType<Index, Variant<Ts...>>& GetUnchecked(
+        const Variant<Ts...>& variant) noexcept;
+
+    template <std::size_t Index, typename... Ts>
+    constexpr const VariantAlternativeType<Index, Variant<Ts...>>&& GetUnchecked(
+        const Variant<Ts...>&& variant) noexcept;
+
+    template <typename T, typename... Ts>
+    constexpr T& GetUnchecked(Variant<Ts...>& variant) noexcept;
+
+    template <typename T, typename... Ts>
+    constexpr T&& GetUnchecked(Variant<Ts...>&& variant) noexcept;
+
+    template <typename T, typename... Ts>
+    constexpr const T& GetUnchecked(const Variant<Ts...>& variant) noexcept;
+
+    template <typename T, typename... Ts>
+    constexpr const T&& GetUnchecked(const Variant<Ts...>&& variant) noexcept;
+
     template <std::size_t Index, typename... Ts>
     constexpr std::add_pointer_t<VariantAlternativeType<Index, Variant<Ts...>>> GetIf(
         Variant<Ts...>* variant) noexcept;
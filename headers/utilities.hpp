@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <numeric>
+#include <type_traits>
 #include <utility>
 
 namespace utilities
@@ -61,6 +62,15 @@ namespace utilities
             std::type_identity<To> operator()(To, From&&) const;
         };
 
+        // Reference alternatives are chosen for lvalues only
+        template <typename To, std::size_t Index>
+        struct Overload<To&, Index>
+        {
+            template <typename From>
+                requires(std::is_lvalue_reference_v<From> && std::is_convertible_v<From, To&>)
+            std::type_identity<To&> operator()(To&, From&&) const;
+        };
+
         template <typename... Overloads>
         struct AllOverloads : Overloads...
         {
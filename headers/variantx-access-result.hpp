@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <variantx-checks.hpp>
+
+namespace variantx
+{
+    enum class AccessError : std::uint8_t
+    {
+        WrongAlternative = 1,
+        Valueless        = 2
+    };
+
+    /*
+     * Result of TryGet: either a reference to the alternative or an AccessError.
+     * Just a pointer and an error code, trivially copyable, never throws on construction.
+     */
+    template <typename T>
+    class AccessResult
+    {
+        static_assert(!std::is_reference_v<T>, "AccessResult<T> already stores T&");
+
+    public:
+        using ValueType = T;
+        using ErrorType = AccessError;
+
+        constexpr explicit AccessResult(T& value) noexcept
+            : value_(std::addressof(value)), error_()
+        {
+        }
+
+        constexpr AccessResult(AccessError error) noexcept  // NOLINT -> non-explicit
+            : value_(nullptr), error_(error)
+        {
+        }
+
+        // AccessResult<T> -> AccessResult<const T>
+        template <typename U>
+            requires(!std::is_same_v<U, T> && std::is_convertible_v<U*, T*>)
+        constexpr AccessResult(const AccessResult<U>& that) noexcept  // NOLINT -> non-explicit
+            : value_(that.HasValue() ? std::addressof(*that) : nullptr),
+              error_(that.HasValue() ? AccessError() : that.Error())
+        {
+        }
+
+        constexpr bool HasValue() const noexcept { return value_ != nullptr; }
+
+        constexpr explicit operator bool() const noexcept { return HasValue(); }
+
+        // Checked according to VARIANTX_CHECKS, as Get is.
+        constexpr T& Value() const
+        {
+            impl::Check(HasValue());
+            return *value_;
+        }
+
+        // Precondition: HasValue()
+        constexpr T& operator*() const noexcept { return *value_; }
+
+        // Precondition: HasValue()
+        constexpr T* operator->() const noexcept { return value_; }
+
+        // Precondition: !HasValue()
+        constexpr AccessError Error() const noexcept { return error_; }
+
+        template <typename U>
+        constexpr std::remove_cv_t<T> ValueOr(U&& other) const
+        {
+            return HasValue() ? *value_ : static_cast<std::remove_cv_t<T>>(std::forward<U>(other));
+        }
+
+        /*
+         * Monadic interface, the same as std::expected has.
+         */
+
+        // Func returns an AccessResult or a std::expected with AccessError as the error
+        template <typename Func>
+        constexpr auto AndThen(Func&& func) const
+        {
+            using Result = std::remove_cvref_t<std::invoke_result_t<Func, T&>>;
+
+            if (HasValue())
+            {
+                return std::invoke(std::forward<Func>(func), *value_);
+            }
+
+            if constexpr (std::is_constructible_v<Result, std::unexpect_t, AccessError>)
+            {
+                return Result(std::unexpect, error_);
+            }
+            else
+            {
+                return Result(error_);
+            }
+        }
+
+        // Func returns an lvalue reference -> AccessResult, otherwise std::expected.
+        template <typename Func>
+        constexpr auto Transform(Func&& func) const
+        {
+            using Result = std::invoke_result_t<Func, T&>;
+
+            if constexpr (std::is_lvalue_reference_v<Result>)
+            {
+                using Transformed = AccessResult<std::remove_reference_t<Result>>;
+
+                return HasValue() ? Transformed(std::invoke(std::forward<Func>(func), *value_))
+                                  : Transformed(error_);
+            }
+            else
+            {
+                using Transformed = std::expected<std::remove_cv_t<Result>, AccessError>;
+
+                if (!HasValue())
+                {
+                    return Transformed(std::unexpect, error_);
+                }
+
+                if constexpr (std::is_void_v<Result>)
+                {
+                    std::invoke(std::forward<Func>(func), *value_);
+                    return Transformed();
+                }
+                else
+                {
+                    return Transformed(std::invoke(std::forward<Func>(func), *value_));
+                }
+            }
+        }
+
+        template <typename Func>
+        constexpr AccessResult OrElse(Func&& func) const
+        {
+            if (HasValue())
+            {
+                return *this;
+            }
+
+            return std::invoke(std::forward<Func>(func), error_);
+        }
+
+    private:
+        T*          value_;
+        AccessError error_;
+    };
+}  // namespace variantx
@@ -0,0 +1,367 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <variantx.hpp>
+
+/*
+ * Lock-free atomic variant of small trivially copyable alternatives:
+ *
+ * AtomicVariant<Idle, Running, Failed> state;
+ * state.Store(Running{42});
+ * state.Visit(visitor);
+ *
+ * The largest alternative and a one byte index are packed into one machine word, 8 or 16 bytes.
+ * Load, Store, Exchange and CompareExchange are single atomic instructions on that word: a
+ * plain 64-bit atomic, or cmpxchg16b for 16 bytes on x86-64 with GCC or Clang. Elsewhere, or
+ * with -DVARIANTX_ATOMIC_CAS16=0, only variants that fit into 8 bytes are supported.
+ *
+ * The 16-byte word requires a CPU with cmpxchg16b (CX16): every x86-64 CPU except the earliest
+ * AMD64 ones. It is not checked at run time, a 16-byte AtomicVariant faults with SIGILL without
+ * it. Build for such CPUs with -DVARIANTX_ATOMIC_CAS16=0.
+ *
+ * The 16-byte word is written with full barriers and read with one aligned SSE load where that
+ * is atomic (Intel and AMD CPUs with AVX), with cmpxchg16b elsewhere. The memory orders are only
+ * honored for the 8-byte word.
+ */
+
+// clang-format off
+#ifndef VARIANTX_ATOMIC_CAS16
+    #if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+        #define VARIANTX_ATOMIC_CAS16 1
+    #else
+        #define VARIANTX_ATOMIC_CAS16 0
+    #endif
+#endif
+
+#if VARIANTX_ATOMIC_CAS16
+    #include <emmintrin.h>
+    #define VARIANTX_TARGET_CX16 __attribute__((target("cx16")))
+#endif
+
+#if defined(__has_builtin)
+    #if __has_builtin(__builtin_clear_padding)
+        #define VARIANTX_HAS_CLEAR_PADDING 1
+    #endif
+#endif
+
+#ifndef VARIANTX_HAS_CLEAR_PADDING
+    #define VARIANTX_HAS_CLEAR_PADDING 0
+#endif
+
+#if VARIANTX_HAS_CLEAR_PADDING
+    #define VARIANTX_CLEAR_PADDING(pointer) __builtin_clear_padding(pointer)
+#else
+    #define VARIANTX_CLEAR_PADDING(pointer) static_cast<void>(pointer)
+#endif
+// clang-format on
+
+namespace variantx
+{
+    namespace impl::atomic
+    {
+        template <std::size_t Bytes>
+        class Cell;
+
+        template <>
+        class Cell<8>
+        {
+        public:
+            using WordType = std::uint64_t;
+
+            static constexpr bool kIsAlwaysLockFree = std::atomic<WordType>::is_always_lock_free;
+
+            explicit Cell(WordType word) noexcept : word_(word) {}
+
+            WordType Load(std::memory_order order) const noexcept { return word_.load(order); }
+
+            void Store(WordType word, std::memory_order order) noexcept
+            {
+                word_.store(word, order);
+            }
+
+            WordType Exchange(WordType word, std::memory_order order) noexcept
+            {
+                return word_.exchange(word, order);
+            }
+
+            bool CompareExchange(WordType& expected, WordType desired, std::memory_order success,
+                                 std::memory_order failure) noexcept
+            {
+                return word_.compare_exchange_strong(expected, desired, success, failure);
+            }
+
+        private:
+            std::atomic<WordType> word_;
+        };
+
+#if VARIANTX_ATOMIC_CAS16
+        __extension__ typedef unsigned __int128 Uint128;  // NOLINT -> pedantic-safe spelling
+
+        template <>
+        class Cell<16>
+        {
+        public:
+            using WordType = Uint128;
+
+            // On a CPU with cmpxchg16b, which VARIANTX_ATOMIC_CAS16 assumes
+            static constexpr bool kIsAlwaysLockFree = true;
+
+            explicit Cell(WordType word) noexcept { std::memcpy(words_, &word, sizeof(word)); }
+
+            WordType Load(std::memory_order) const noexcept
+            {
+                // Aligned 16-byte SSE loads are atomic on Intel and AMD CPUs with AVX
+                static const bool kHasAtomicLoad =
+                    __builtin_cpu_supports("avx") &&
+                    (__builtin_cpu_is("intel") || __builtin_cpu_is("amd"));
+
+                return kHasAtomicLoad ? LoadVector() : LoadCas();
+            }
+
+            void Store(WordType word, std::memory_order order) noexcept { Exchange(word, order); }
+
+            VARIANTX_TARGET_CX16 WordType Exchange(WordType word, std::memory_order) noexcept
+            {
+                // A torn guess only costs one more round: the failed CAS returns the value
+                WordType seen = Guess();
+                for (;;)
+                {
+                    const WordType previous = __sync_val_compare_and_swap(Word(), seen, word);
+                    if (previous == seen)
+                    {
+                        return previous;
+                    }
+                    seen = previous;
+                }
+            }
+
+            VARIANTX_TARGET_CX16 bool CompareExchange(WordType& expected, WordType desired,
+                                                      std::memory_order,
+                                                      std::memory_order) noexcept
+            {
+                const WordType previous = __sync_val_compare_and_swap(Word(), expected, desired);
+                if (previous == expected)
+                {
+                    return true;
+                }
+                expected = previous;
+                return false;
+            }
+
+        private:
+            WordType* Word() const noexcept
+            {
+                return reinterpret_cast<WordType*>(words_);  // NOLINT
+            }
+
+            WordType LoadVector() const noexcept
+            {
+                __m128i vector;
+                asm volatile("movdqa %1, %0" : "=x"(vector) : "m"(words_) : "memory");  // NOLINT
+
+                WordType word;
+                std::memcpy(&word, &vector, sizeof(word));
+                return word;
+            }
+
+            // cmpxchg16b of the current value with itself
+            VARIANTX_TARGET_CX16 WordType LoadCas() const noexcept
+            {
+                return __sync_val_compare_and_swap(Word(), WordType(0), WordType(0));
+            }
+
+            // Both halves read atomically, but not together
+            WordType Guess() const noexcept
+            {
+                const std::uint64_t halves[] = {  // NOLINT -> c-style array
+                    __atomic_load_n(&words_[0], __ATOMIC_RELAXED),
+                    __atomic_load_n(&words_[1], __ATOMIC_RELAXED)};
+
+                WordType word;
+                std::memcpy(&word, halves, sizeof(word));
+                return word;
+            }
+
+            // Written by LoadCas as well, cmpxchg16b always stores
+            alignas(16) mutable std::uint64_t words_[2];  // NOLINT -> c-style array
+        };
+#endif
+
+        template <typename... Ts>
+        constexpr std::size_t kPayloadSize = std::max({sizeof(Ts)...});
+
+        // Payload bytes, then the index
+        template <typename... Ts>
+        constexpr std::size_t kWordSize = kPayloadSize<Ts...> + 1 <= 8 ? 8 : 16;
+    }  // namespace impl::atomic
+
+    /*
+     * The value is never valueless: storing a valueless variant is checked as an access to it.
+     *
+     * Equality in CompareExchange is equality of the object representation, as for std::atomic.
+     * Padding inside an alternative is cleared where the compiler provides
+     * __builtin_clear_padding (VARIANTX_HAS_CLEAR_PADDING), otherwise alternatives with padding
+     * may compare unequal.
+     */
+    template <typename... Ts>
+    class AtomicVariant
+    {
+        static_assert((std::is_trivially_copyable_v<Ts> && ...),
+                      "AtomicVariant requires trivially copyable alternatives.");
+
+        static_assert(!std::disjunction_v<std::is_reference<Ts>...>,
+                      "AtomicVariant can not have a reference type as an alternative.");
+
+        static_assert(sizeof...(Ts) < 256, "AtomicVariant index must fit into one byte.");
+
+        static_assert(impl::atomic::kPayloadSize<Ts...> + 1 <= (VARIANTX_ATOMIC_CAS16 ? 16 : 8),
+                      "AtomicVariant alternatives are too large for a lock-free word.");
+
+        using CellType = impl::atomic::Cell<impl::atomic::kWordSize<Ts...>>;
+        using WordType = typename CellType::WordType;
+
+        static constexpr std::size_t kIndexOffset = impl::atomic::kPayloadSize<Ts...>;
+
+    public:
+        using ValueType = Variant<Ts...>;
+
+        static constexpr bool kIsAlwaysLockFree = CellType::kIsAlwaysLockFree;
+
+        AtomicVariant() requires(std::is_default_constructible_v<ValueType>)
+            : AtomicVariant(ValueType())
+        {
+        }
+
+        explicit AtomicVariant(const ValueType& value) : cell_(Encode(value)) {}
+
+        AtomicVariant(const AtomicVariant&)            = delete;
+        AtomicVariant& operator=(const AtomicVariant&) = delete;
+
+        ValueType Load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+        {
+            return Decode(cell_.Load(order));
+        }
+
+        void Store(const ValueType& value, std::memory_order order = std::memory_order_seq_cst)
+        {
+            cell_.Store(Encode(value), order);
+        }
+
+        ValueType Exchange(const ValueType& value,
+                           std::memory_order order = std::memory_order_seq_cst)
+        {
+            return Decode(cell_.Exchange(Encode(value), order));
+        }
+
+        // On failure `expected` is updated to the current value
+        bool CompareExchange(ValueType& expected, const ValueType& desired,
+                             std::memory_order success = std::memory_order_seq_cst,
+                             std::memory_order failure = std::memory_order_seq_cst)
+        {
+            WordType   word = Encode(expected);
+            const bool done = cell_.CompareExchange(word, Encode(desired), success, failure);
+            if (!done)
+            {
+                expected = Decode(word);
+            }
+            return done;
+        }
+
+        // Index of the current value, without decoding it
+        std::size_t Index(std::memory_order order = std::memory_order_seq_cst) const noexcept
+        {
+            return IndexOf(cell_.Load(order));
+        }
+
+        // Visits a snapshot of the current value
+        template <typename Visitor>
+        decltype(auto) Visit(Visitor&& visitor,
+                             std::memory_order order = std::memory_order_seq_cst) const
+        {
+            return variantx::Visit(std::forward<Visitor>(visitor), Load(order));
+        }
+
+    private:
+        using Bytes = std::array<std::byte, sizeof(WordType)>;
+
+        static WordType Encode(const ValueType& value)
+        {
+            impl::CheckNotValueless(value);
+
+            // Unused bytes stay zero, equal values have equal words
+            Bytes bytes{};
+            EncodeAlternative<0>(bytes, value);
+            bytes[kIndexOffset] = static_cast<std::byte>(value.Index());
+
+            WordType word;
+            std::memcpy(&word, bytes.data(), sizeof(word));
+            return word;
+        }
+
+        static std::size_t IndexOf(WordType word) noexcept
+        {
+            Bytes bytes;
+            std::memcpy(bytes.data(), &word, sizeof(word));
+            return static_cast<std::size_t>(bytes[kIndexOffset]);
+        }
+
+        static ValueType Decode(WordType word) noexcept
+        {
+            Bytes bytes;
+            std::memcpy(bytes.data(), &word, sizeof(word));
+            return DecodeAlternative<0>(bytes, static_cast<std::size_t>(bytes[kIndexOffset]));
+        }
+
+        /*
+         * A chain of compares rather than a table of functions: the alternatives are few and
+         * trivially copied, the whole chain is inlined into Load and Store.
+         */
+
+        template <std::size_t Index>
+        static void EncodeAlternative(Bytes& bytes, const ValueType& value) noexcept
+        {
+            if constexpr (Index + 1 < sizeof...(Ts))
+            {
+                if (value.Index() != Index)
+                {
+                    EncodeAlternative<Index + 1>(bytes, value);
+                    return;
+                }
+            }
+
+            auto alternative = GetUnchecked<Index>(value);
+            VARIANTX_CLEAR_PADDING(&alternative);
+            std::memcpy(bytes.data(), &alternative, sizeof(alternative));
+        }
+
+        template <std::size_t Index>
+        static ValueType DecodeAlternative(const Bytes& bytes, std::size_t index) noexcept
+        {
+            if constexpr (Index + 1 < sizeof...(Ts))
+            {
+                if (index != Index)
+                {
+                    return DecodeAlternative<Index + 1>(bytes, index);
+                }
+            }
+
+            using T = VariantAlternativeType<Index, ValueType>;
+
+            // memcpy starts the lifetime of a trivially copyable object
+            alignas(T) std::byte storage[sizeof(T)];  // NOLINT -> c-style array
+            std::memcpy(storage, bytes.data(), sizeof(T));
+            return ValueType(std::in_place_index<Index>,
+                             *std::launder(reinterpret_cast<T*>(storage)));  // NOLINT
+        }
+
+        CellType cell_;
+    };
+}  // namespace variantx
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <atomic>
+#include <cstdlib>
+#include <stdexcept>
+#include <utility>
+#include <variantx-exceptions.hpp>
+
+/*
+ * Policy of checked access (Get, Visit), selected at compile time:
+ *
+ * -DVARIANTX_CHECKS=throw  -> throw variantx::BadVariantAccess (default)
+ * -DVARIANTX_CHECKS=abort  -> call the terminate handler
+ * -DVARIANTX_CHECKS=assume -> the check is a precondition, the compiler is told it always holds
+ *
+ * Without exceptions (-fno-exceptions) `throw` falls back to `abort`.
+ */
+
+// clang-format off
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+    #define VARIANTX_HAS_EXCEPTIONS 1
+#else
+    #define VARIANTX_HAS_EXCEPTIONS 0
+#endif
+
+#define VARIANTX_CHECKS_throw  1
+#define VARIANTX_CHECKS_abort  2
+#define VARIANTX_CHECKS_assume 3
+
+#ifndef VARIANTX_CHECKS
+    #define VARIANTX_CHECKS throw
+#endif
+
+#define VARIANTX_CHECKS_CONCAT_IMPL(prefix, mode) prefix##mode
+#define VARIANTX_CHECKS_CONCAT(prefix, mode) VARIANTX_CHECKS_CONCAT_IMPL(prefix, mode)
+#define VARIANTX_CHECKS_MODE VARIANTX_CHECKS_CONCAT(VARIANTX_CHECKS_, VARIANTX_CHECKS)
+
+#if VARIANTX_CHECKS_MODE != VARIANTX_CHECKS_throw &&  \
+    VARIANTX_CHECKS_MODE != VARIANTX_CHECKS_abort &&  \
+    VARIANTX_CHECKS_MODE != VARIANTX_CHECKS_assume
+    #error "VARIANTX_CHECKS should be one of: throw, abort, assume"
+#endif
+// clang-format on
+
+namespace variantx
+{
+    // Called on failed checked access when it can not throw. Should not return, std::abort()
+    // is called right after it otherwise.
+    using TerminateHandler = void (*)(const char* reason) noexcept;
+
+    namespace impl
+    {
+        inline std::atomic<TerminateHandler>& TerminateHandlerStorage() noexcept
+        {
+            static std::atomic<TerminateHandler> handler = nullptr;
+            return handler;
+        }
+    }  // namespace impl
+
+    // Returns the previous handler, nullptr stands for the default one (std::abort()).
+    inline TerminateHandler SetTerminateHandler(TerminateHandler handler) noexcept
+    {
+        return impl::TerminateHandlerStorage().exchange(handler);
+    }
+
+    inline TerminateHandler GetTerminateHandler() noexcept
+    {
+        return impl::TerminateHandlerStorage().load();
+    }
+
+    namespace impl
+    {
+        [[noreturn]] inline void Terminate(const char* reason) noexcept
+        {
+            if (TerminateHandler handler = GetTerminateHandler(); handler != nullptr)
+            {
+                handler(reason);
+            }
+
+            std::abort();
+        }
+
+        [[noreturn]] inline void BadAccess()
+        {
+#if VARIANTX_CHECKS_MODE == VARIANTX_CHECKS_throw && VARIANTX_HAS_EXCEPTIONS
+            throw BadVariantAccess();
+#elif VARIANTX_CHECKS_MODE == VARIANTX_CHECKS_assume
+            std::unreachable();
+#else
+            Terminate(BadVariantAccess().what());
+#endif
+        }
+
+        // Container outgrew its compact offsets, std::length_error as std containers do
+        [[noreturn]] inline void LengthError(const char* what)
+        {
+#if VARIANTX_HAS_EXCEPTIONS
+            throw std::length_error(what);
+#else
+            Terminate(what);
+#endif
+        }
+
+        constexpr void Assume(bool condition) noexcept
+        {
+            if (!condition)
+            {
+                std::unreachable();
+            }
+        }
+
+        constexpr void Check(bool condition)
+        {
+            if (!condition) [[unlikely]]
+            {
+                BadAccess();
+            }
+        }
+    }  // namespace impl
+}  // namespace variantx
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variantx.hpp>
+#include <vector>
+
+namespace variantx
+{
+    /*
+     * Closed-set polymorphic collection, as boost::poly_collection for variants:
+     * one std::vector per alternative (a segment) and no tag per element at all.
+     *
+     * The order across alternatives is not kept, only the order inside a segment.
+     * ForEach runs one monomorphic loop per segment, the visitor is never dispatched.
+     */
+    template <typename... Ts>
+    class VariantCollection
+    {
+        static_assert(0 < sizeof...(Ts), "VariantCollection must have at least one alternative.");
+        static_assert(!(std::is_reference_v<Ts> || ...),
+                      "VariantCollection can not have a reference type as an alternative.");
+
+        // std::vector<bool> packs bits, there is no bool object to refer to
+        static_assert(!(std::is_same_v<std::remove_cv_t<Ts>, bool> || ...),
+                      "VariantCollection can not have bool as an alternative.");
+
+        template <std::size_t Index>
+        using Alternative = utilities::GetTypeByIndex<Index, Ts...>;
+
+        template <typename T>
+        static constexpr std::size_t kIndexOf = utilities::FindUnambiguousIndex<T, Ts...>::value;
+
+    public:
+        VariantCollection() = default;
+
+        std::size_t Size() const noexcept
+        {
+            return std::apply([](const auto&... segments) { return (segments.size() + ...); },
+                              segments_);
+        }
+
+        bool Empty() const noexcept { return Size() == 0; }
+
+        void Clear() noexcept
+        {
+            std::apply([](auto&... segments) { (segments.clear(), ...); }, segments_);
+        }
+
+        template <std::size_t Index>
+            requires(Index < sizeof...(Ts))
+        void Reserve(std::size_t capacity)
+        {
+            std::get<Index>(segments_).reserve(capacity);
+        }
+
+        template <typename T, std::size_t Index = kIndexOf<T>>
+        void Reserve(std::size_t capacity)
+        {
+            Reserve<Index>(capacity);
+        }
+
+        template <std::size_t Index, typename... Args>
+            requires(Index < sizeof...(Ts) && std::is_constructible_v<Alternative<Index>, Args...>)
+        Alternative<Index>& Emplace(Args&&... args)
+        {
+            return std::get<Index>(segments_).emplace_back(std::forward<Args>(args)...);
+        }
+
+        template <typename T, typename... Args, std::size_t Index = kIndexOf<T>>
+            requires(std::is_constructible_v<T, Args...>)
+        T& Emplace(Args&&... args)
+        {
+            return Emplace<Index>(std::forward<Args>(args)...);
+        }
+
+        // The segment is selected as the converting constructor of Variant<Ts...> does
+        template <typename Arg, typename T = utilities::SelectorType<Arg, Ts...>,
+                  std::size_t Index = kIndexOf<T>>
+            requires(!std::is_same_v<std::remove_cvref_t<Arg>, Variant<Ts...>> &&
+                     std::is_constructible_v<T, Arg>)
+        T& Insert(Arg&& arg)
+        {
+            return Emplace<Index>(std::forward<Arg>(arg));
+        }
+
+        // A valueless variant is checked as Visit does
+        void Insert(const Variant<Ts...>& variant)
+            requires(std::is_copy_constructible_v<Ts> && ...)
+        {
+            InsertVariant(variant);
+        }
+
+        void Insert(Variant<Ts...>&& variant)
+            requires(std::is_move_constructible_v<Ts> && ...)
+        {
+            InsertVariant(std::move(variant));
+        }
+
+        // Elements of one alternative, in insertion order
+        template <std::size_t Index>
+        std::span<Alternative<Index>> Segment() noexcept
+        {
+            return std::get<Index>(segments_);
+        }
+
+        template <std::size_t Index>
+        std::span<const Alternative<Index>> Segment() const noexcept
+        {
+            return std::get<Index>(segments_);
+        }
+
+        template <typename T, std::size_t Index = kIndexOf<T>>
+        std::span<T> Segment() noexcept
+        {
+            return Segment<Index>();
+        }
+
+        template <typename T, std::size_t Index = kIndexOf<T>>
+        std::span<const T> Segment() const noexcept
+        {
+            return Segment<Index>();
+        }
+
+        // Calls `visitor` for every element, segment after segment in alternative order
+        template <typename Visitor>
+        void ForEach(Visitor&& visitor)
+        {
+            std::apply([&visitor](auto&... segments) { (ForEachIn(visitor, segments), ...); },
+                       segments_);
+        }
+
+        template <typename Visitor>
+        void ForEach(Visitor&& visitor) const
+        {
+            std::apply([&visitor](const auto&... segments)
+                       { (ForEachIn(visitor, segments), ...); },
+                       segments_);
+        }
+
+    private:
+        template <typename Visitor, typename Vector>
+        static void ForEachIn(Visitor& visitor, Vector& segment)
+        {
+            for (auto& value : segment)
+            {
+                std::invoke(visitor, value);
+            }
+        }
+
+        template <typename TVariant>
+        void InsertVariant(TVariant&& variant)
+        {
+            impl::CheckNotValueless(variant);
+
+            constexpr auto kTable = []<std::size_t... Indices>(std::index_sequence<Indices...>)
+            {
+                return std::array<void (*)(VariantCollection&, TVariant&&), sizeof...(Ts)>{
+                    [](VariantCollection& self, TVariant&& from) {
+                        self.Emplace<Indices>(GetUnchecked<Indices>(std::forward<TVariant>(from)));
+                    }...};
+            }(std::index_sequence_for<Ts...>());
+
+            kTable[variant.Index()](*this, std::forward<TVariant>(variant));
+        }
+
+        std::tuple<std::vector<Ts>...> segments_;
+    };
+}  // namespace variantx
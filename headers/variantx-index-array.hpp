@@ -0,0 +1,224 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <fwd/variantx.hpp>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace variantx
+{
+    /*
+     * Discriminators of a variant container packed into ceil(log2(Alternatives + 1)) bits each:
+     * 2 bits for 3 alternatives, 3 bits for 4 to 7. The extra value stands for a valueless
+     * element, kVariantNpos on the way out.
+     *
+     * Tags never straddle a 64-bit word, a word holds 64 / kBits of them. Counting, search and
+     * histogram compare all the tags of a word at once (SWAR) without a branch per tag, so a
+     * scan is bound by memory bandwidth.
+     */
+    template <std::size_t Alternatives>
+    class PackedIndexArray
+    {
+        static_assert(0 < Alternatives, "PackedIndexArray must have at least one alternative.");
+
+    public:
+        using WordType = std::uint64_t;
+
+        static constexpr std::size_t kBits    = std::bit_width(Alternatives);
+        static constexpr std::size_t kPerWord = std::numeric_limits<WordType>::digits / kBits;
+
+        static constexpr std::size_t kNotFound = std::numeric_limits<std::size_t>::max();
+
+        PackedIndexArray() = default;
+
+        std::size_t Size() const noexcept { return size_; }
+
+        bool Empty() const noexcept { return size_ == 0; }
+
+        void Reserve(std::size_t capacity)
+        {
+            words_.reserve((capacity + kPerWord - 1) / kPerWord);
+        }
+
+        void Clear() noexcept
+        {
+            words_.clear();
+            size_ = 0;
+        }
+
+        // `index` is an alternative or kVariantNpos
+        void PushBack(std::size_t index)
+        {
+            if (size_ % kPerWord == 0)
+            {
+                words_.push_back(0);
+            }
+
+            ++size_;
+            Set(size_ - 1, index);
+        }
+
+        // Precondition: position < Size()
+        void Set(std::size_t position, std::size_t index) noexcept
+        {
+            const std::size_t shift = (position % kPerWord) * kBits;
+            WordType&         word  = words_[position / kPerWord];
+
+            word = (word & ~(kFieldMask << shift)) | (Encode(index) << shift);
+        }
+
+        // Precondition: position < Size()
+        std::size_t operator[](std::size_t position) const noexcept
+        {
+            const std::size_t shift = (position % kPerWord) * kBits;
+            const auto        field = (words_[position / kPerWord] >> shift) & kFieldMask;
+
+            return field == Alternatives ? kVariantNpos : static_cast<std::size_t>(field);
+        }
+
+        // Number of elements holding the alternative, kVariantNpos counts valueless ones
+        std::size_t Count(std::size_t index) const noexcept
+        {
+            const WordType    pattern = kLow * Encode(index);
+            const std::size_t full    = size_ / kPerWord;
+
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < full; ++i)
+            {
+                count += std::popcount(Match(words_[i], pattern));
+            }
+
+            if (full != words_.size())
+            {
+                count += std::popcount(Match(words_[full], pattern) & TailFields());
+            }
+
+            return count;
+        }
+
+        template <std::size_t Index>
+            requires(Index < Alternatives)
+        std::size_t CountAlternative() const noexcept
+        {
+            return Count(Index);
+        }
+
+        // Position of the first element at or after `from` holding the alternative, or kNotFound
+        std::size_t FindFirst(std::size_t index, std::size_t from = 0) const noexcept
+        {
+            if (from >= size_)
+            {
+                return kNotFound;
+            }
+
+            const WordType    pattern = kLow * Encode(index);
+            const std::size_t full    = size_ / kPerWord;
+
+            // Fields before `from` are not candidates
+            WordType skip = ~WordType(0) << ((from % kPerWord) * kBits);
+            for (std::size_t i = from / kPerWord; i < words_.size(); ++i)
+            {
+                const WordType valid   = i < full ? skip : skip & TailFields();
+                const WordType matches = Match(words_[i], pattern) & valid;
+                if (matches != 0)
+                {
+                    const auto field = static_cast<std::size_t>(std::countr_zero(matches)) / kBits;
+                    return i * kPerWord + field;
+                }
+                skip = ~WordType(0);
+            }
+
+            return kNotFound;
+        }
+
+        // Number of elements per alternative, valueless ones are not counted
+        std::array<std::size_t, Alternatives> Histogram() const noexcept
+        {
+            std::array<std::size_t, Alternatives> histogram{};
+
+            if constexpr (Alternatives <= kPerWord)
+            {
+                // One pass, every word is compared against every alternative while it is loaded
+                const std::size_t full = size_ / kPerWord;
+                for (std::size_t i = 0; i < full; ++i)
+                {
+                    for (std::size_t index = 0; index < Alternatives; ++index)
+                    {
+                        histogram[index] += std::popcount(Match(words_[i], kLow * index));
+                    }
+                }
+
+                if (full != words_.size())
+                {
+                    for (std::size_t index = 0; index < Alternatives; ++index)
+                    {
+                        histogram[index] +=
+                            std::popcount(Match(words_[full], kLow * index) & TailFields());
+                    }
+                }
+            }
+            else
+            {
+                // Wide tags, a word holds fewer of them than there are alternatives
+                for (std::size_t position = 0; position < size_; ++position)
+                {
+                    const std::size_t index = (*this)[position];
+                    if (index != kVariantNpos)
+                    {
+                        ++histogram[index];
+                    }
+                }
+            }
+
+            return histogram;
+        }
+
+        // Storage, for the callers that scan the tags themselves
+        std::span<const WordType> Words() const noexcept { return words_; }
+
+    private:
+        static constexpr WordType kFieldMask = (WordType(1) << kBits) - 1;
+
+        // The lowest bit of every field
+        static constexpr WordType kLow = []
+        {
+            WordType low = 0;
+            for (std::size_t i = 0; i < kPerWord; ++i)
+            {
+                low |= WordType(1) << (i * kBits);
+            }
+            return low;
+        }();
+
+        // The highest bit of every field and the rest of it
+        static constexpr WordType kHigh    = kLow << (kBits - 1);
+        static constexpr WordType kLowBits = kLow * ((WordType(1) << (kBits - 1)) - 1);
+
+        static constexpr WordType Encode(std::size_t index) noexcept
+        {
+            return index == kVariantNpos ? Alternatives : index;
+        }
+
+        // High bit of every field equal to the field of `pattern`, no carry crosses fields
+        static constexpr WordType Match(WordType word, WordType pattern) noexcept
+        {
+            const WordType difference = word ^ pattern;
+            const WordType non_zero   = (((difference & kLowBits) + kLowBits) | difference) & kHigh;
+
+            return ~non_zero & kHigh;
+        }
+
+        // High bits of the fields of the last, partially filled, word
+        WordType TailFields() const noexcept
+        {
+            return kHigh & ((WordType(1) << ((size_ % kPerWord) * kBits)) - 1);
+        }
+
+        std::vector<WordType> words_;
+        std::size_t           size_ = 0;
+    };
+}  // namespace variantx
@@ -0,0 +1,444 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <variantx.hpp>
+
+namespace variantx
+{
+    /*
+     * Append-only stream of variants where every element takes only what its alternative needs:
+     *
+     * [tag][padding][payload of Alternative<tag>][tag][padding][payload]...
+     *
+     * The tag is the compact index of Variant<Ts...>, the payload is aligned for its own type.
+     * A log of small records with a rare large one is no longer padded to the large one.
+     *
+     * Iteration yields VariantRef<Ts...> (ConstVariantRef<Ts...> for const buffers).
+     * Growing relocates the elements, so references are invalidated as in std::vector.
+     * A buffer of trivially copyable alternatives is copied and relocated with one memcpy.
+     */
+    template <typename... Ts>
+    class PackedVariantBuffer
+    {
+        static_assert(0 < sizeof...(Ts), "PackedVariantBuffer must have at least one alternative.");
+        static_assert(!(std::is_reference_v<Ts> || ...),
+                      "PackedVariantBuffer can not have a reference type as an alternative.");
+        static_assert(((alignof(Ts) <= alignof(std::max_align_t)) && ...),
+                      "PackedVariantBuffer does not support over-aligned alternatives.");
+        // Relocation on growth has no way to roll back a throwing move
+        static_assert(
+            ((std::is_trivially_copyable_v<Ts> || std::is_nothrow_move_constructible_v<Ts>) && ...),
+                      "PackedVariantBuffer alternatives should be nothrow move constructible.");
+
+        template <std::size_t Index>
+        using Alternative = utilities::GetTypeByIndex<Index, Ts...>;
+
+        static constexpr bool kTriviallyCopyable = (std::is_trivially_copyable_v<Ts> && ...);
+        static constexpr bool kTriviallyDestructible =
+            (std::is_trivially_destructible_v<Ts> && ...);
+
+        static constexpr std::size_t kMinCapacity = 256;
+
+    public:
+        using IndexType      = impl::CompactIndex<sizeof...(Ts)>;
+        using Reference      = VariantRef<Ts...>;
+        using ConstReference = ConstVariantRef<Ts...>;
+
+        template <bool Const>
+        class Iterator;
+
+        using iterator       = Iterator<false>;  // NOLINT -> range-for and <ranges> interop
+        using const_iterator = Iterator<true>;   // NOLINT
+
+        PackedVariantBuffer() = default;
+
+        PackedVariantBuffer(const PackedVariantBuffer& that)
+            requires(std::is_copy_constructible_v<Ts> && ...)
+            : PackedVariantBuffer()
+        {
+            // Fully constructed from here on, a throwing copy destroys what is already copied
+            Reserve(that.size_);
+
+            if constexpr (kTriviallyCopyable)
+            {
+                if (that.size_ != 0)
+                {
+                    std::memcpy(data_.get(), that.data_.get(), that.size_);
+                }
+                size_  = that.size_;
+                count_ = that.count_;
+            }
+            else
+            {
+                constexpr auto kCopy = []<std::size_t... Indices>(std::index_sequence<Indices...>)
+                {
+                    return std::array<void (*)(PackedVariantBuffer&, const std::byte*),
+                                      sizeof...(Ts)>{
+                        [](PackedVariantBuffer& self, const std::byte* payload)
+                        { self.Emplace<Indices>(*Payload<Alternative<Indices>>(payload)); }...};
+                }(std::index_sequence_for<Ts...>());
+
+                for (std::size_t offset = 0; offset != that.size_;)
+                {
+                    const Element element = that.Read(offset);
+                    kCopy[element.index_](*this, that.data_.get() + element.payload_);
+                    offset = element.next_;
+                }
+            }
+        }
+
+        PackedVariantBuffer(PackedVariantBuffer&& that) noexcept
+            : data_(std::move(that.data_)),
+              capacity_(std::exchange(that.capacity_, 0)),
+              size_(std::exchange(that.size_, 0)),
+              count_(std::exchange(that.count_, 0))
+        {
+        }
+
+        PackedVariantBuffer& operator=(const PackedVariantBuffer& that)
+            requires(std::is_copy_constructible_v<Ts> && ...)
+        {
+            if (this != &that)
+            {
+                PackedVariantBuffer(that).Swap(*this);
+            }
+            return *this;
+        }
+
+        PackedVariantBuffer& operator=(PackedVariantBuffer&& that) noexcept
+        {
+            PackedVariantBuffer(std::move(that)).Swap(*this);
+            return *this;
+        }
+
+        ~PackedVariantBuffer() { DestroyAll(); }
+
+        void Swap(PackedVariantBuffer& that) noexcept
+        {
+            std::swap(data_, that.data_);
+            std::swap(capacity_, that.capacity_);
+            std::swap(size_, that.size_);
+            std::swap(count_, that.count_);
+        }
+
+        // Number of elements
+        std::size_t Size() const noexcept { return count_; }
+
+        bool Empty() const noexcept { return count_ == 0; }
+
+        // Bytes taken by the elements, tags and padding included
+        std::size_t SizeBytes() const noexcept { return size_; }
+
+        std::size_t CapacityBytes() const noexcept { return capacity_; }
+
+        void Reserve(std::size_t bytes)
+        {
+            if (bytes > capacity_)
+            {
+                Relocate(bytes);
+            }
+        }
+
+        void Clear() noexcept
+        {
+            DestroyAll();
+            size_  = 0;
+            count_ = 0;
+        }
+
+        // Appends an element, strong exception guarantee
+        template <std::size_t Index, typename... Args>
+            requires(Index < sizeof...(Ts) && std::is_constructible_v<Alternative<Index>, Args...>)
+        Alternative<Index>& Emplace(Args&&... args)
+        {
+            using T = Alternative<Index>;
+
+            const std::size_t payload = AlignUp(size_ + sizeof(IndexType), alignof(T));
+            const std::size_t next    = payload + sizeof(T);
+
+            T* value = nullptr;
+            if (next > capacity_)
+            {
+                // `args` may refer to an element: constructed before the elements are moved
+                const std::size_t capacity = std::max({next, capacity_ * 2, kMinCapacity});
+                auto data = std::make_unique_for_overwrite<std::byte[]>(capacity);  // NOLINT
+
+                value = std::construct_at(Storage<T>(data.get() + payload),
+                                          std::forward<Args>(args)...);
+
+                RelocateTo(data.get());
+                data_     = std::move(data);
+                capacity_ = capacity;
+            }
+            else
+            {
+                value = std::construct_at(Storage<T>(data_.get() + payload),
+                                          std::forward<Args>(args)...);
+            }
+
+            const auto index = static_cast<IndexType>(Index);
+            std::memcpy(data_.get() + size_, &index, sizeof(IndexType));
+
+            size_ = next;
+            ++count_;
+            return *value;
+        }
+
+        template <typename T, typename... Args,
+                  std::size_t Index = utilities::FindUnambiguousIndex<T, Ts...>::value>
+            requires(std::is_constructible_v<T, Args...>)
+        T& Emplace(Args&&... args)
+        {
+            return Emplace<Index>(std::forward<Args>(args)...);
+        }
+
+        // A valueless variant is checked as Visit does
+        void PushBack(const Variant<Ts...>& variant)
+            requires(std::is_copy_constructible_v<Ts> && ...)
+        {
+            impl::CheckNotValueless(variant);
+
+            constexpr auto kTable = []<std::size_t... Indices>(std::index_sequence<Indices...>)
+            {
+                return std::array<void (*)(PackedVariantBuffer&, const Variant<Ts...>&),
+                                  sizeof...(Ts)>{
+                    [](PackedVariantBuffer& self, const Variant<Ts...>& from)
+                    { self.Emplace<Indices>(GetUnchecked<Indices>(from)); }...};
+            }(std::index_sequence_for<Ts...>());
+
+            kTable[variant.Index()](*this, variant);
+        }
+
+        iterator begin() noexcept { return iterator(data_.get(), 0); }  // NOLINT
+        iterator end() noexcept { return iterator(data_.get(), size_); }  // NOLINT
+
+        const_iterator begin() const noexcept { return const_iterator(data_.get(), 0); }  // NOLINT
+        const_iterator end() const noexcept  // NOLINT
+        {
+            return const_iterator(data_.get(), size_);
+        }
+
+        /*
+         * Calls `visitor` with every element in order. Cheaper than Visit on every element
+         * of the range: the alternative is passed directly, no VariantRef in between.
+         */
+        template <typename Visitor>
+        void VisitAll(Visitor&& visitor)
+        {
+            VisitAllImpl(*this, visitor);
+        }
+
+        template <typename Visitor>
+        void VisitAll(Visitor&& visitor) const
+        {
+            VisitAllImpl(*this, visitor);
+        }
+
+    private:
+        struct Element
+        {
+            std::size_t index_;
+            std::size_t payload_;
+            std::size_t next_;
+        };
+
+        static constexpr std::array<std::size_t, sizeof...(Ts)> kSizes{sizeof(Ts)...};
+        static constexpr std::array<std::size_t, sizeof...(Ts)> kAlignments{alignof(Ts)...};
+
+        static constexpr std::size_t AlignUp(std::size_t offset, std::size_t alignment) noexcept
+        {
+            return (offset + alignment - 1) & ~(alignment - 1);
+        }
+
+        // Raw storage for a new object
+        template <typename T>
+        static T* Storage(std::byte* payload) noexcept
+        {
+            return reinterpret_cast<T*>(payload);  // NOLINT
+        }
+
+        // A living object
+        template <typename T>
+        static T* Payload(std::byte* payload) noexcept
+        {
+            return std::launder(reinterpret_cast<T*>(payload));  // NOLINT
+        }
+
+        template <typename T>
+        static const T* Payload(const std::byte* payload) noexcept
+        {
+            return std::launder(reinterpret_cast<const T*>(payload));  // NOLINT
+        }
+
+        static Element Read(const std::byte* data, std::size_t offset) noexcept
+        {
+            IndexType index;
+            std::memcpy(&index, data + offset, sizeof(IndexType));
+
+            const std::size_t payload = AlignUp(offset + sizeof(IndexType), kAlignments[index]);
+            return {index, payload, payload + kSizes[index]};
+        }
+
+        Element Read(std::size_t offset) const noexcept { return Read(data_.get(), offset); }
+
+        template <typename Self, typename Visitor>
+        static void VisitAllImpl(Self& self, Visitor& visitor)
+        {
+            using Byte = std::conditional_t<std::is_const_v<Self>, const std::byte, std::byte>;
+
+            constexpr auto kTable = []<std::size_t... Indices>(std::index_sequence<Indices...>)
+            {
+                return std::array<void (*)(Visitor&, Byte*), sizeof...(Ts)>{
+                    [](Visitor& to, Byte* payload)
+                    { std::invoke(to, *Payload<Alternative<Indices>>(payload)); }...};
+            }(std::index_sequence_for<Ts...>());
+
+            for (std::size_t offset = 0; offset != self.size_;)
+            {
+                const Element element = self.Read(offset);
+                kTable[element.index_](visitor, self.data_.get() + element.payload_);
+                offset = element.next_;
+            }
+        }
+
+        void Relocate(std::size_t capacity)
+        {
+            auto data = std::make_unique_for_overwrite<std::byte[]>(capacity);  // NOLINT
+            RelocateTo(data.get());
+
+            data_     = std::move(data);
+            capacity_ = capacity;
+        }
+
+        // Every offset stays the same: both blocks are aligned for std::max_align_t
+        void RelocateTo(std::byte* data) noexcept
+        {
+            if constexpr (kTriviallyCopyable)
+            {
+                if (size_ != 0)
+                {
+                    std::memcpy(data, data_.get(), size_);
+                }
+            }
+            else
+            {
+                constexpr std::array<void (*)(std::byte*, std::byte*) noexcept, sizeof...(Ts)>
+                    kRelocate{[](std::byte* from, std::byte* to) noexcept
+                              {
+                                  Ts* value = Payload<Ts>(from);
+                                  std::construct_at(Storage<Ts>(to), std::move(*value));
+                                  std::destroy_at(value);
+                              }...};
+
+                for (std::size_t offset = 0; offset != size_;)
+                {
+                    const Element element = Read(offset);
+                    std::memcpy(data + offset, data_.get() + offset, sizeof(IndexType));
+                    kRelocate[element.index_](data_.get() + element.payload_,
+                                              data + element.payload_);
+                    offset = element.next_;
+                }
+            }
+        }
+
+        void DestroyAll() noexcept
+        {
+            if constexpr (!kTriviallyDestructible)
+            {
+                constexpr std::array<void (*)(std::byte*) noexcept, sizeof...(Ts)> kDestroy{
+                    [](std::byte* payload) noexcept { std::destroy_at(Payload<Ts>(payload)); }...};
+
+                for (std::size_t offset = 0; offset != size_;)
+                {
+                    const Element element = Read(offset);
+                    kDestroy[element.index_](data_.get() + element.payload_);
+                    offset = element.next_;
+                }
+            }
+        }
+
+        std::unique_ptr<std::byte[]> data_;  // NOLINT -> c-style array
+        std::size_t                  capacity_ = 0;
+        std::size_t                  size_     = 0;
+        std::size_t                  count_    = 0;
+    };
+
+    template <typename... Ts>
+    template <bool Const>
+    class PackedVariantBuffer<Ts...>::Iterator
+    {
+        using Byte = std::conditional_t<Const, const std::byte, std::byte>;
+
+        friend class PackedVariantBuffer;
+
+        Iterator(Byte* data, std::size_t offset) noexcept : data_(data), offset_(offset) {}
+
+    public:
+        using value_type        = std::conditional_t<Const, ConstReference, Reference>;  // NOLINT
+        using reference         = value_type;                                           // NOLINT
+        using difference_type   = std::ptrdiff_t;                                       // NOLINT
+        using iterator_concept  = std::forward_iterator_tag;                            // NOLINT
+        using iterator_category = std::input_iterator_tag;                              // NOLINT
+
+        Iterator() = default;
+
+        // iterator -> const_iterator, a template not to be taken for the copy constructor
+        template <bool ThatConst>
+            requires(Const && !ThatConst)
+        Iterator(const Iterator<ThatConst>& that) noexcept  // NOLINT -> non-explicit
+            : data_(that.data_), offset_(that.offset_)
+        {
+        }
+
+        value_type operator*() const noexcept
+        {
+            constexpr auto kTable = []<std::size_t... Indices>(std::index_sequence<Indices...>)
+            {
+                return std::array<value_type (*)(Byte*), sizeof...(Ts)>{
+                    [](Byte* payload) -> value_type {
+                        return value_type(std::in_place_index<Indices>,
+                                          *Payload<Alternative<Indices>>(payload));
+                    }...};
+            }(std::index_sequence_for<Ts...>());
+
+            const Element element = Read(data_, offset_);
+            return kTable[element.index_](data_ + element.payload_);
+        }
+
+        // Index of the alternative without building a reference
+        std::size_t Index() const noexcept { return Read(data_, offset_).index_; }
+
+        Iterator& operator++() noexcept
+        {
+            offset_ = Read(data_, offset_).next_;
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept
+        {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept
+        {
+            return lhs.offset_ == rhs.offset_;
+        }
+
+    private:
+        friend class Iterator<!Const>;
+
+        Byte*       data_   = nullptr;
+        std::size_t offset_ = 0;
+    };
+}  // namespace variantx
@@ -0,0 +1,332 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <fwd/variantx.hpp>
+#include <memory>
+#include <memory_resource>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variantx.hpp>
+
+namespace variantx::pmr
+{
+    /*
+     * Allocator-aware Variant: every alternative is constructed with uses-allocator construction
+     * from the memory resource of the variant, so a Variant<std::pmr::string, ...> keeps its
+     * allocations in the resource it was created with (e.g. a per-request arena).
+     *
+     * The resource follows the rules of the std::pmr containers:
+     *  - Emplace, converting and copy assignment construct with the resource of the target,
+     *    the resource itself never changes after construction
+     *  - the move constructor takes the resource of the source
+     *  - the copy constructor uses the default resource, the allocator-extended one
+     *    (std::allocator_arg, allocator, that) is what std::pmr containers call for their
+     *    elements, so a pmr::vector<pmr::Variant<...>> keeps the copies in its own resource
+     */
+    template <typename... Ts>
+    class Variant : public variantx::Variant<Ts...>
+    {
+        static_assert(!std::disjunction_v<std::is_reference<Ts>...>,
+                      "pmr::Variant can not have a reference type as an alternative.");
+
+        using BaseType = variantx::Variant<Ts...>;
+
+        template <std::size_t Index>
+        using Alternative = VariantAlternativeType<Index, BaseType>;
+
+        struct PiecewiseTag
+        {
+        };
+
+    public:
+        using allocator_type = std::pmr::polymorphic_allocator<>;  // NOLINT -> std::uses_allocator
+
+        Variant() requires(std::is_default_constructible_v<Alternative<0>>)
+            : Variant(std::allocator_arg, allocator_type())
+        {
+        }
+
+        // NOLINTNEXTLINE -> unnamed parameter
+        Variant([[maybe_unused]] std::allocator_arg_t, const allocator_type& allocator)
+            : Variant(std::allocator_arg, allocator, std::in_place_index<0>)
+        {
+        }
+
+        Variant(const Variant& that) requires(std::is_copy_constructible_v<BaseType>)
+            : Variant(std::allocator_arg, allocator_type(), that)
+        {
+        }
+
+        Variant(Variant&& that) noexcept(std::is_nothrow_move_constructible_v<BaseType>)
+            requires(std::is_move_constructible_v<BaseType>)
+            : BaseType(std::move(that)), allocator_(that.allocator_)
+        {
+        }
+
+        // NOLINTNEXTLINE -> unnamed parameter
+        Variant([[maybe_unused]] std::allocator_arg_t, const allocator_type& allocator,
+                const BaseType& that)
+            : BaseType(Rebind(allocator, that)), allocator_(allocator)
+        {
+        }
+
+        // NOLINTNEXTLINE -> unnamed parameter
+        Variant([[maybe_unused]] std::allocator_arg_t, const allocator_type& allocator,
+                BaseType&& that)
+            : BaseType(Rebind(allocator, std::move(that))), allocator_(allocator)
+        {
+        }
+
+        // clang-format off
+        template <typename Arg,
+                  typename T = utilities::SelectorType<Arg, Ts...>,
+                  std::size_t Index = utilities::FindUnambiguousIndex<T, Ts...>::value>
+            requires (
+                !std::is_base_of_v<BaseType, std::remove_cvref_t<Arg>> &&
+                !std::is_same_v<std::remove_cvref_t<Arg>, std::allocator_arg_t> &&
+                !utilities::IsInplaceType<std::remove_cvref_t<Arg>>::value &&
+                !utilities::IsInplaceIndex<std::remove_cvref_t<Arg>>::value
+            )
+        Variant(Arg&& arg)  // NOLINT -> non-explicit
+            : Variant(std::allocator_arg, allocator_type(), std::in_place_index<Index>,
+                      std::forward<Arg>(arg))
+        {
+        }
+        // clang-format on
+
+        // clang-format off
+        template <typename Arg,
+                  typename T = utilities::SelectorType<Arg, Ts...>,
+                  std::size_t Index = utilities::FindUnambiguousIndex<T, Ts...>::value>
+            requires (
+                !std::is_base_of_v<BaseType, std::remove_cvref_t<Arg>> &&
+                !utilities::IsInplaceType<std::remove_cvref_t<Arg>>::value &&
+                !utilities::IsInplaceIndex<std::remove_cvref_t<Arg>>::value
+            )
+        // NOLINTNEXTLINE -> unnamed parameter
+        Variant([[maybe_unused]] std::allocator_arg_t, const allocator_type& allocator, Arg&& arg)
+            : Variant(std::allocator_arg, allocator, std::in_place_index<Index>,
+                      std::forward<Arg>(arg))
+        {
+        }
+        // clang-format on
+
+        template <std::size_t Index, typename... Args>
+            requires(Index < sizeof...(Ts))
+        explicit Variant(std::in_place_index_t<Index> tag, Args&&... args)
+            : Variant(std::allocator_arg, allocator_type(), tag, std::forward<Args>(args)...)
+        {
+        }
+
+        // clang-format off
+        template <std::size_t Index, typename... Args>
+            requires(Index < sizeof...(Ts))
+        // NOLINTNEXTLINE -> unnamed parameter
+        Variant([[maybe_unused]] std::allocator_arg_t, const allocator_type& allocator,
+                std::in_place_index_t<Index> tag, Args&&... args)
+            : Variant(PiecewiseTag(), tag, allocator,
+                      ConstructionArgs<Index>(allocator, std::forward<Args>(args)...))
+        {
+        }
+        // clang-format on
+
+        template <typename T, typename... Args,
+                  std::size_t Index = utilities::FindUnambiguousIndex<T, Ts...>::value>
+        // NOLINTNEXTLINE -> unnamed parameter
+        explicit Variant([[maybe_unused]] std::in_place_type_t<T>, Args&&... args)
+            : Variant(std::allocator_arg, allocator_type(), std::in_place_index<Index>,
+                      std::forward<Args>(args)...)
+        {
+        }
+
+        // clang-format off
+        template <typename T, typename... Args,
+                  std::size_t Index = utilities::FindUnambiguousIndex<T, Ts...>::value>
+        // NOLINTNEXTLINE -> unnamed parameter
+        Variant([[maybe_unused]] std::allocator_arg_t, const allocator_type& allocator,
+                [[maybe_unused]] std::in_place_type_t<T>, Args&&... args)
+            : Variant(std::allocator_arg, allocator, std::in_place_index<Index>,
+                      std::forward<Args>(args)...)
+        {
+        }
+        // clang-format on
+
+        ~Variant() = default;
+
+        Variant& operator=(const Variant& that) requires(std::is_copy_constructible_v<BaseType> &&
+                                                         std::is_copy_assignable_v<BaseType>)
+        {
+            if (this != &that)
+            {
+                AssignFrom(static_cast<const BaseType&>(that));
+            }
+            return *this;
+        }
+
+        // Moves the alternative when both use the same resource, copies it into ours otherwise
+        Variant& operator=(Variant&& that) requires(std::is_move_constructible_v<BaseType> &&
+                                                    std::is_move_assignable_v<BaseType>)
+        {
+            if (allocator_ == that.allocator_)
+            {
+                BaseType::operator=(static_cast<BaseType&&>(that));
+            }
+            else
+            {
+                AssignFrom(static_cast<BaseType&&>(that));
+            }
+            return *this;
+        }
+
+        // clang-format off
+        template <typename Arg,
+                  typename T = utilities::SelectorType<Arg, Ts...>,
+                  std::size_t Index = utilities::FindUnambiguousIndex<T, Ts...>::value>
+            requires (
+                !std::is_base_of_v<BaseType, std::remove_cvref_t<Arg>> &&
+                std::is_assignable_v<T&, Arg>
+            )
+        Variant& operator=(Arg&& arg)
+        {
+            EmplaceOrAssign<Index>(std::forward<Arg>(arg));
+            return *this;
+        }
+        // clang-format on
+
+        /*
+         * Emplace and EmplaceOrAssign offer the basic guarantee: if constructing the new
+         * alternative throws, the variant is valueless.
+         */
+
+        template <std::size_t Index, typename... Args>
+            requires(Index < sizeof...(Ts))
+        Alternative<Index>& Emplace(Args&&... args)
+        {
+            return std::apply(
+                [this](auto&&... constructor_args) -> Alternative<Index>&
+                {
+                    return BaseType::template Emplace<Index>(
+                        std::forward<decltype(constructor_args)>(constructor_args)...);
+                },
+                ConstructionArgs<Index>(allocator_, std::forward<Args>(args)...));
+        }
+
+        template <typename T, typename... Args,
+                  std::size_t Index = utilities::FindUnambiguousIndex<T, Ts...>::value>
+        T& Emplace(Args&&... args)
+        {
+            return Emplace<Index>(std::forward<Args>(args)...);
+        }
+
+        template <std::size_t Index, typename Arg>
+            requires(Index < sizeof...(Ts) && std::is_assignable_v<Alternative<Index>&, Arg>)
+        Alternative<Index>& EmplaceOrAssign(Arg&& arg)
+        {
+            if (this->Index() == Index)
+            {
+                Alternative<Index>& alternative = GetUnchecked<Index>(*this);
+                alternative                     = std::forward<Arg>(arg);
+                return alternative;
+            }
+
+            return Emplace<Index>(std::forward<Arg>(arg));
+        }
+
+        template <typename T, typename Arg,
+                  std::size_t Index = utilities::FindUnambiguousIndex<T, Ts...>::value>
+            requires(std::is_assignable_v<T&, Arg>)
+        T& EmplaceOrAssign(Arg&& arg)
+        {
+            return EmplaceOrAssign<Index>(std::forward<Arg>(arg));
+        }
+
+        allocator_type GetAllocator() const noexcept { return allocator_; }
+
+        // Precondition: GetAllocator() == that.GetAllocator(), as for the std::pmr containers
+        // NOLINTNEXTLINE
+        void swap(Variant& that) noexcept(noexcept(std::declval<BaseType&>().swap(that)))
+        {
+            BaseType::swap(that);
+        }
+
+    private:
+        // Both construct without the allocator
+        using BaseType::EmplaceWith;
+        using BaseType::Reset;
+
+        template <std::size_t Index, typename Args>
+        // NOLINTNEXTLINE -> unnamed parameter
+        Variant([[maybe_unused]] PiecewiseTag, std::in_place_index_t<Index> tag,
+                const allocator_type& allocator, Args&& args)
+            : Variant(PiecewiseTag(), tag, allocator, std::forward<Args>(args),
+                      std::make_index_sequence<std::tuple_size_v<std::remove_cvref_t<Args>>>())
+        {
+        }
+
+        // The alternative is constructed in place from the uses-allocator arguments
+        template <std::size_t Index, typename Args, std::size_t... Positions>
+        // NOLINTNEXTLINE -> unnamed parameter
+        Variant([[maybe_unused]] PiecewiseTag, std::in_place_index_t<Index> tag,
+                const allocator_type& allocator, Args&& args,
+                [[maybe_unused]] std::index_sequence<Positions...>)
+            : BaseType(tag, std::get<Positions>(std::forward<Args>(args))...), allocator_(allocator)
+        {
+        }
+
+        template <std::size_t Index, typename... Args>
+        static auto ConstructionArgs(const allocator_type& allocator, Args&&... args)
+        {
+            return std::uses_allocator_construction_args<Alternative<Index>>(
+                allocator, std::forward<Args>(args)...);
+        }
+
+        // The alternative of `that` constructed with `allocator`, valueless stays valueless
+        template <typename That>
+        static BaseType Rebind(const allocator_type& allocator, That&& that)
+        {
+            if (that.ValuelessByException())
+            {
+                return BaseType(std::forward<That>(that));
+            }
+
+            constexpr auto kTable = []<std::size_t... Indices>(std::index_sequence<Indices...>)
+            {
+                return std::array<BaseType (*)(const allocator_type&, That&&), sizeof...(Ts)>{
+                    [](const allocator_type& allocator, That&& from) -> BaseType
+                    {
+                        return std::make_from_tuple<BaseType>(std::tuple_cat(
+                            std::tuple(std::in_place_index<Indices>),
+                            ConstructionArgs<Indices>(
+                                allocator, GetUnchecked<Indices>(std::forward<That>(from)))));
+                    }...};
+            }(std::index_sequence_for<Ts...>());
+
+            return kTable[that.Index()](allocator, std::forward<That>(that));
+        }
+
+        template <typename That>
+        void AssignFrom(That&& that)
+        {
+            if (that.ValuelessByException())
+            {
+                BaseType::operator=(std::forward<That>(that));
+                return;
+            }
+
+            constexpr auto kTable = []<std::size_t... Indices>(std::index_sequence<Indices...>)
+            {
+                return std::array<void (*)(Variant&, That&&), sizeof...(Ts)>{
+                    [](Variant& self, That&& from) {
+                        self.template EmplaceOrAssign<Indices>(
+                            GetUnchecked<Indices>(std::forward<That>(from)));
+                    }...};
+            }(std::index_sequence_for<Ts...>());
+
+            kTable[that.Index()](*this, std::forward<That>(that));
+        }
+
+        allocator_type allocator_;
+    };
+}  // namespace variantx::pmr
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace variantx
+{
+    /*
+     * Bump allocator for the nodes of recursive variants (ASTs, JSON trees).
+     *
+     * Memory is handed out from big chunks and released all at once when the arena dies.
+     * Destructors are recorded only for objects that are not trivially destructible, so a tree
+     * of trivially destructible nodes is freed chunk by chunk without touching the nodes.
+     */
+    class Arena
+    {
+    public:
+        static constexpr std::size_t kDefaultChunkSize = 64 * 1024;
+
+        explicit Arena(std::size_t chunk_size = kDefaultChunkSize) : chunk_size_(chunk_size) {}
+
+        Arena(const Arena&)            = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        ~Arena()
+        {
+            // Reverse order of construction, as for automatic objects
+            for (auto it = destructors_.rbegin(); it != destructors_.rend(); ++it)
+            {
+                it->destroy_(it->object_, it->count_);
+            }
+        }
+
+        // Precondition: alignment is a power of two not greater than alignof(max_align_t)
+        void* Allocate(std::size_t size, std::size_t alignment)
+        {
+            auto address = reinterpret_cast<std::uintptr_t>(cursor_);  // NOLINT
+            auto aligned = (address + alignment - 1) & ~(alignment - 1);
+
+            if (cursor_ == nullptr || aligned + size > reinterpret_cast<std::uintptr_t>(end_))
+            {
+                Grow(size + alignment);
+
+                address = reinterpret_cast<std::uintptr_t>(cursor_);  // NOLINT
+                aligned = (address + alignment - 1) & ~(alignment - 1);
+            }
+
+            cursor_ += aligned - address + size;      // NOLINT -> pointer arithmetic
+            return reinterpret_cast<void*>(aligned);  // NOLINT
+        }
+
+        template <typename T, typename... Args>
+        T* Create(Args&&... args)
+        {
+            T* object = std::construct_at(static_cast<T*>(Allocate(sizeof(T), alignof(T))),
+                                          std::forward<Args>(args)...);
+            RegisterDestructor(object, 1);
+            return object;
+        }
+
+        // `count` value-initialized objects
+        template <typename T>
+        T* CreateArray(std::size_t count)
+        {
+            T* objects = static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+            std::uninitialized_value_construct_n(objects, count);
+            RegisterDestructor(objects, count);
+            return objects;
+        }
+
+        // Bytes handed out from the chunks so far, including alignment padding
+        std::size_t BytesUsed() const noexcept
+        {
+            return used_ + static_cast<std::size_t>(cursor_ - chunk_begin_);
+        }
+
+    private:
+        struct Destructor
+        {
+            void*       object_;
+            std::size_t count_;
+            void (*destroy_)(void*, std::size_t) noexcept;
+        };
+
+        template <typename T>
+        void RegisterDestructor(T* objects, std::size_t count)
+        {
+            if constexpr (!std::is_trivially_destructible_v<T>)
+            {
+                destructors_.push_back(
+                    {objects, count, [](void* pointer, std::size_t size) noexcept
+                     { std::destroy_n(static_cast<T*>(pointer), size); }});
+            }
+        }
+
+        void Grow(std::size_t at_least)
+        {
+            const std::size_t size = std::max(chunk_size_, at_least);
+
+            used_ += static_cast<std::size_t>(cursor_ - chunk_begin_);
+
+            chunks_.push_back(std::make_unique_for_overwrite<std::byte[]>(size));
+            chunk_begin_ = chunks_.back().get();
+            cursor_      = chunk_begin_;
+            end_         = chunk_begin_ + size;  // NOLINT -> pointer arithmetic
+        }
+
+        std::size_t                               chunk_size_;
+        std::size_t                               used_        = 0;
+        std::byte*                                chunk_begin_ = nullptr;
+        std::byte*                                cursor_      = nullptr;
+        std::byte*                                end_         = nullptr;
+        std::vector<std::unique_ptr<std::byte[]>> chunks_;  // NOLINT -> c-style array
+        std::vector<Destructor>                   destructors_;
+    };
+
+    /*
+     * Box for a recursive alternative, `T` may be incomplete where the variant is declared:
+     *
+     * struct Json;
+     * using Array = std::vector<Json>;
+     * struct Json : Variant<std::nullptr_t, double, std::string, Recursive<Array>> { ... };
+     *
+     * The node lives in an Arena, the box is a pointer: trivially copyable, copies share the
+     * node. Constness propagates to the node. Visit passes the node itself to the visitor.
+     */
+    template <typename T>
+    class Recursive
+    {
+    public:
+        using ValueType = T;
+
+        template <typename... Args>
+        explicit Recursive(Arena& arena, Args&&... args)
+            : pointer_(arena.Create<T>(std::forward<Args>(args)...))
+        {
+        }
+
+        constexpr T&       operator*() noexcept { return *pointer_; }
+        constexpr const T& operator*() const noexcept { return *pointer_; }
+
+        constexpr T*       operator->() noexcept { return pointer_; }
+        constexpr const T* operator->() const noexcept { return pointer_; }
+
+    private:
+        T* pointer_;
+    };
+
+    namespace impl
+    {
+        // Alternatives Visit sees through, Shared<T> is added in variantx-shared.hpp
+        template <typename T>
+        constexpr bool kIsBox = false;
+
+        template <typename T>
+        constexpr bool kIsBox<Recursive<T>> = true;
+
+        /*
+         * Sees through boxes, forwards anything else. Not noexcept: Shared<T> may clone.
+         *
+         * Copies of a box share its node, so a box is unboxed as an lvalue even when it is an
+         * rvalue: the node must not be moved from under the other copies.
+         */
+        template <typename T>
+        constexpr decltype(auto) Unbox(T&& value)
+        {
+            if constexpr (kIsBox<std::remove_cvref_t<T>>)
+            {
+                return *value;
+            }
+            else
+            {
+                return std::forward<T>(value);
+            }
+        }
+    }  // namespace impl
+}  // namespace variantx
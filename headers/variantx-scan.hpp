@@ -0,0 +1,447 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <variantx.hpp>
+#include <vector>
+
+/*
+ * Scans over the discriminators of contiguous arrays of variants: count, find, positions and
+ * histogram by alternative, without going through Index() element by element.
+ *
+ * On x86 with GCC or Clang an AVX2 kernel (gather of 8 tags at the variant stride, one compare,
+ * one movemask) is selected at runtime when the CPU has AVX2. Elsewhere, or with
+ * -DVARIANTX_SCAN_AVX2=0, a portable scalar loop is used.
+ */
+
+// clang-format off
+#ifndef VARIANTX_SCAN_AVX2
+    #if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+        #define VARIANTX_SCAN_AVX2 1
+    #else
+        #define VARIANTX_SCAN_AVX2 0
+    #endif
+#endif
+
+#if VARIANTX_SCAN_AVX2
+    #include <immintrin.h>
+    #define VARIANTX_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+// clang-format on
+
+namespace variantx
+{
+    namespace impl::scan
+    {
+        template <typename Range>
+        constexpr bool kIsVariantRange =
+            std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range> &&
+            kIsVariant<std::remove_cv_t<std::ranges::range_value_t<Range>>>;
+
+        template <typename T, typename TVariant>
+        struct IndexOf;
+
+        template <typename T, typename... Ts>
+        struct IndexOf<T, Variant<Ts...>> : utilities::FindUnambiguousIndex<T, Ts...>
+        {
+        };
+
+        // `count_` tags of type Tag, `stride_` bytes apart
+        template <typename Tag>
+        struct Strided
+        {
+            const std::byte* base_;
+            std::size_t      count_;
+            std::size_t      stride_;
+
+            Tag At(std::size_t position) const noexcept
+            {
+                Tag tag;
+                std::memcpy(&tag, base_ + position * stride_, sizeof(Tag));
+                return tag;
+            }
+        };
+
+        template <typename Range>
+        auto Tags(const Range& variants) noexcept
+        {
+            using TVariant = std::remove_cv_t<std::ranges::range_value_t<Range>>;
+            using Tag      = std::remove_cvref_t<
+                decltype(*access::Variant::Discriminator(std::declval<const TVariant&>()))>;
+
+            const std::size_t count = std::ranges::size(variants);
+            if (count == 0)
+            {
+                return Strided<Tag>{nullptr, 0, sizeof(TVariant)};
+            }
+
+            const TVariant* first = std::ranges::data(variants);
+            const auto*     tag   = access::Variant::Discriminator(*first);
+
+            return Strided<Tag>{reinterpret_cast<const std::byte*>(tag),  // NOLINT
+                                count, sizeof(TVariant)};
+        }
+
+        // The stored form of an index: kVariantNpos is the maximum of Tag, as in CompactIndex
+        template <typename Tag>
+        constexpr Tag Encode(std::size_t index) noexcept
+        {
+            return static_cast<Tag>(index);
+        }
+
+        /*
+         * Scalar kernels, each starts at `from`: the SIMD kernels leave the tail to them
+         */
+
+        template <typename Tag>
+        std::size_t CountScalar(const Strided<Tag>& tags, Tag value, std::size_t from) noexcept
+        {
+            std::size_t count = 0;
+            for (std::size_t i = from; i < tags.count_; ++i)
+            {
+                count += tags.At(i) == value ? 1 : 0;
+            }
+            return count;
+        }
+
+        template <typename Tag>
+        std::size_t FindScalar(const Strided<Tag>& tags, Tag value, std::size_t from) noexcept
+        {
+            for (std::size_t i = from; i < tags.count_; ++i)
+            {
+                if (tags.At(i) == value)
+                {
+                    return i;
+                }
+            }
+            return kVariantNpos;
+        }
+
+        template <typename Tag>
+        void PositionsScalar(const Strided<Tag>& tags, Tag value, std::size_t from,
+                             std::vector<std::size_t>& positions)
+        {
+            for (std::size_t i = from; i < tags.count_; ++i)
+            {
+                if (tags.At(i) == value)
+                {
+                    positions.push_back(i);
+                }
+            }
+        }
+
+        // The last bin collects valueless elements
+        template <std::size_t Bins, typename Tag>
+        void HistogramScalar(const Strided<Tag>& tags, std::size_t from,
+                             std::array<std::size_t, Bins + 1>& histogram) noexcept
+        {
+            for (std::size_t i = from; i < tags.count_; ++i)
+            {
+                ++histogram[std::min<std::size_t>(tags.At(i), Bins)];
+            }
+        }
+
+#if VARIANTX_SCAN_AVX2
+        inline bool HasAvx2() noexcept
+        {
+            static const bool kHasAvx2 = __builtin_cpu_supports("avx2");
+            return kHasAvx2;
+        }
+
+        /*
+         * A gather loads 4 bytes at every tag. Blocks stop before the last element, so a load
+         * never leaves the array as long as a variant is at least 4 bytes big.
+         */
+        template <typename Tag>
+        bool UseAvx2(const Strided<Tag>& tags) noexcept
+        {
+            constexpr std::size_t kLanes = 8;
+
+            return sizeof(Tag) <= 2 && tags.stride_ >= 4 &&
+                   tags.stride_ <= std::numeric_limits<std::int32_t>::max() / kLanes &&
+                   tags.count_ > kLanes && HasAvx2();
+        }
+
+        // Lanes holding `value` for the tags [first, first + 8), as the low 8 bits
+        template <typename Tag>
+        VARIANTX_TARGET_AVX2 inline unsigned MatchAvx2(const Strided<Tag>& tags, __m256i offsets,
+                                                       std::size_t first, __m256i pattern) noexcept
+        {
+            constexpr int kTagMask = (1 << (8 * sizeof(Tag))) - 1;
+
+            const auto* base = reinterpret_cast<const int*>(  // NOLINT
+                tags.base_ + first * tags.stride_);
+
+            const __m256i loaded = _mm256_i32gather_epi32(base, offsets, 1);
+            const __m256i tag    = _mm256_and_si256(loaded, _mm256_set1_epi32(kTagMask));
+
+            return static_cast<unsigned>(
+                _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(tag, pattern))));
+        }
+
+        VARIANTX_TARGET_AVX2 inline __m256i OffsetsAvx2(std::size_t stride) noexcept
+        {
+            return _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                      _mm256_set1_epi32(static_cast<int>(stride)));
+        }
+
+        // Every AVX2 kernel returns the number of tags it went through in `done`
+        template <typename Tag>
+        VARIANTX_TARGET_AVX2 std::size_t CountAvx2(const Strided<Tag>& tags, Tag value,
+                                                   std::size_t& done) noexcept
+        {
+            const __m256i offsets = OffsetsAvx2(tags.stride_);
+            const __m256i pattern = _mm256_set1_epi32(value);
+
+            std::size_t count = 0;
+            std::size_t i     = 0;
+            for (; i + 8 < tags.count_; i += 8)
+            {
+                count += std::popcount(MatchAvx2(tags, offsets, i, pattern));
+            }
+
+            done = i;
+            return count;
+        }
+
+        template <typename Tag>
+        VARIANTX_TARGET_AVX2 std::size_t FindAvx2(const Strided<Tag>& tags, Tag value,
+                                                  std::size_t from, std::size_t& done) noexcept
+        {
+            const __m256i offsets = OffsetsAvx2(tags.stride_);
+            const __m256i pattern = _mm256_set1_epi32(value);
+
+            std::size_t i = from;
+            for (; i + 8 < tags.count_; i += 8)
+            {
+                const unsigned matches = MatchAvx2(tags, offsets, i, pattern);
+                if (matches != 0)
+                {
+                    return i + static_cast<std::size_t>(std::countr_zero(matches));
+                }
+            }
+
+            done = i;
+            return kVariantNpos;
+        }
+
+        template <typename Tag>
+        VARIANTX_TARGET_AVX2 void PositionsAvx2(const Strided<Tag>& tags, Tag value,
+                                                std::vector<std::size_t>& positions,
+                                                std::size_t&              done)
+        {
+            const __m256i offsets = OffsetsAvx2(tags.stride_);
+            const __m256i pattern = _mm256_set1_epi32(value);
+
+            std::size_t i = 0;
+            for (; i + 8 < tags.count_; i += 8)
+            {
+                for (unsigned matches = MatchAvx2(tags, offsets, i, pattern); matches != 0;
+                     matches &= matches - 1)
+                {
+                    positions.push_back(i + static_cast<std::size_t>(std::countr_zero(matches)));
+                }
+            }
+
+            done = i;
+        }
+
+        // One gather per block, compared against every alternative
+        template <std::size_t Bins, typename Tag>
+        VARIANTX_TARGET_AVX2 void HistogramAvx2(const Strided<Tag>& tags,
+                                                std::array<std::size_t, Bins + 1>& histogram,
+                                                std::size_t&                       done) noexcept
+        {
+            constexpr int kTagMask = (1 << (8 * sizeof(Tag))) - 1;
+
+            const __m256i offsets = OffsetsAvx2(tags.stride_);
+
+            std::size_t i = 0;
+            for (; i + 8 < tags.count_; i += 8)
+            {
+                const auto* base = reinterpret_cast<const int*>(  // NOLINT
+                    tags.base_ + i * tags.stride_);
+
+                const __m256i tag = _mm256_and_si256(_mm256_i32gather_epi32(base, offsets, 1),
+                                                     _mm256_set1_epi32(kTagMask));
+
+                std::size_t matched = 0;
+                for (std::size_t bin = 0; bin < Bins; ++bin)
+                {
+                    const __m256i equal =
+                        _mm256_cmpeq_epi32(tag, _mm256_set1_epi32(static_cast<int>(bin)));
+                    const auto count = static_cast<std::size_t>(std::popcount(
+                        static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(equal)))));
+
+                    histogram[bin] += count;
+                    matched += count;
+                }
+                histogram[Bins] += 8 - matched;
+            }
+
+            done = i;
+        }
+#endif
+
+        /*
+         * Dispatch
+         */
+
+        template <typename Tag>
+        std::size_t Count(const Strided<Tag>& tags, Tag value) noexcept
+        {
+            std::size_t count = 0;
+            std::size_t done  = 0;
+#if VARIANTX_SCAN_AVX2
+            if constexpr (sizeof(Tag) <= 2)
+            {
+                if (UseAvx2(tags))
+                {
+                    count = CountAvx2(tags, value, done);
+                }
+            }
+#endif
+            return count + CountScalar(tags, value, done);
+        }
+
+        template <typename Tag>
+        std::size_t Find(const Strided<Tag>& tags, Tag value, std::size_t from) noexcept
+        {
+            std::size_t done = from;
+#if VARIANTX_SCAN_AVX2
+            if constexpr (sizeof(Tag) <= 2)
+            {
+                if (UseAvx2(tags))
+                {
+                    const std::size_t found = FindAvx2(tags, value, from, done);
+                    if (found != kVariantNpos)
+                    {
+                        return found;
+                    }
+                }
+            }
+#endif
+            return FindScalar(tags, value, done);
+        }
+
+        template <typename Tag>
+        std::vector<std::size_t> Positions(const Strided<Tag>& tags, Tag value)
+        {
+            std::vector<std::size_t> positions;
+            std::size_t              done = 0;
+#if VARIANTX_SCAN_AVX2
+            if constexpr (sizeof(Tag) <= 2)
+            {
+                if (UseAvx2(tags))
+                {
+                    PositionsAvx2(tags, value, positions, done);
+                }
+            }
+#endif
+            PositionsScalar(tags, value, done, positions);
+            return positions;
+        }
+
+        // A compare per alternative and block pays off only for a handful of alternatives
+        inline constexpr std::size_t kMaxSimdHistogramBins = 16;
+
+        template <std::size_t Bins, typename Tag>
+        std::array<std::size_t, Bins> Histogram(const Strided<Tag>& tags) noexcept
+        {
+            std::array<std::size_t, Bins + 1> histogram{};
+            std::size_t                       done = 0;
+#if VARIANTX_SCAN_AVX2
+            if constexpr (sizeof(Tag) <= 2 && Bins <= kMaxSimdHistogramBins)
+            {
+                if (UseAvx2(tags))
+                {
+                    HistogramAvx2<Bins>(tags, histogram, done);
+                }
+            }
+#endif
+            HistogramScalar<Bins>(tags, done, histogram);
+
+            std::array<std::size_t, Bins> result;
+            std::copy_n(histogram.begin(), Bins, result.begin());
+            return result;
+        }
+    }  // namespace impl::scan
+
+    /*
+     * Every function takes a contiguous range of Variant (std::vector, std::array, std::span,
+     * a C array). `Index` may be kVariantNpos to look for valueless elements.
+     */
+
+    template <std::size_t Index, typename Range>
+        requires(impl::scan::kIsVariantRange<Range>)
+    std::size_t CountAlternative(const Range& variants) noexcept
+    {
+        const auto tags = impl::scan::Tags(variants);
+        using Tag       = std::remove_cvref_t<decltype(tags.At(0))>;
+
+        return impl::scan::Count(tags, impl::scan::Encode<Tag>(Index));
+    }
+
+    template <typename T, typename Range>
+        requires(impl::scan::kIsVariantRange<Range>)
+    std::size_t CountAlternative(const Range& variants) noexcept
+    {
+        using TVariant = std::remove_cv_t<std::ranges::range_value_t<Range>>;
+        return CountAlternative<impl::scan::IndexOf<T, TVariant>::value>(variants);
+    }
+
+    // Position of the first element at or after `from` holding the alternative, or kVariantNpos
+    template <std::size_t Index, typename Range>
+        requires(impl::scan::kIsVariantRange<Range>)
+    std::size_t FindAlternative(const Range& variants, std::size_t from = 0) noexcept
+    {
+        const auto tags = impl::scan::Tags(variants);
+        using Tag       = std::remove_cvref_t<decltype(tags.At(0))>;
+
+        return impl::scan::Find(tags, impl::scan::Encode<Tag>(Index), from);
+    }
+
+    template <typename T, typename Range>
+        requires(impl::scan::kIsVariantRange<Range>)
+    std::size_t FindAlternative(const Range& variants, std::size_t from = 0) noexcept
+    {
+        using TVariant = std::remove_cv_t<std::ranges::range_value_t<Range>>;
+        return FindAlternative<impl::scan::IndexOf<T, TVariant>::value>(variants, from);
+    }
+
+    // Positions of all the elements holding the alternative, ascending
+    template <std::size_t Index, typename Range>
+        requires(impl::scan::kIsVariantRange<Range>)
+    std::vector<std::size_t> PositionsOf(const Range& variants)
+    {
+        const auto tags = impl::scan::Tags(variants);
+        using Tag       = std::remove_cvref_t<decltype(tags.At(0))>;
+
+        return impl::scan::Positions(tags, impl::scan::Encode<Tag>(Index));
+    }
+
+    template <typename T, typename Range>
+        requires(impl::scan::kIsVariantRange<Range>)
+    std::vector<std::size_t> PositionsOf(const Range& variants)
+    {
+        using TVariant = std::remove_cv_t<std::ranges::range_value_t<Range>>;
+        return PositionsOf<impl::scan::IndexOf<T, TVariant>::value>(variants);
+    }
+
+    // Number of elements per alternative, valueless elements are not counted
+    template <typename Range>
+        requires(impl::scan::kIsVariantRange<Range>)
+    auto IndexHistogram(const Range& variants) noexcept
+    {
+        using TVariant = std::remove_cv_t<std::ranges::range_value_t<Range>>;
+        return impl::scan::Histogram<kVariantSizeV<TVariant>>(impl::scan::Tags(variants));
+    }
+}  // namespace variantx
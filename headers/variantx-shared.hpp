@@ -0,0 +1,172 @@
+#pragma once
+
+#include <atomic>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <variantx-checks.hpp>
+#include <variantx-recursive.hpp>
+
+namespace variantx
+{
+    /*
+     * Copy-on-write box for large, rarely mutated alternatives:
+     *
+     * using Config = Variant<std::int64_t, std::string, Shared<Table>>;
+     *
+     * Copies share the payload and bump an atomic reference count, so a variant is copied
+     * across threads without copying the table. Const access reads the shared payload, non-const
+     * access (operator*, operator-> and Visit on a non-const variant) first clones it if another
+     * copy still refers to it. Visit passes the payload itself to the visitor: the constness of
+     * the variant decides, visit std::as_const(variant) to read a shared payload without a clone.
+     *
+     * A reference from non-const access may outlive the call: the payload is then marked
+     * unshareable, later copies of this box clone it rather than share a payload that is still
+     * being written through that reference.
+     *
+     * A moved-from box holds nothing: it may be copied, assigned and destroyed, any access to the
+     * payload (operator*, operator->, comparison, hashing) is a checked access.
+     */
+    template <typename T>
+    class Shared
+    {
+        struct Block
+        {
+            template <typename... Args>
+            explicit Block(std::in_place_t, Args&&... args) : value_(std::forward<Args>(args)...)
+            {
+            }
+
+            std::atomic<std::size_t> count_    = 1;
+            bool                     unshared_ = false;  // Written only while count_ is 1
+            T                        value_;
+        };
+
+    public:
+        using ValueType = T;
+
+        Shared() requires(std::is_default_constructible_v<T>)
+            : block_(new Block(std::in_place))
+        {
+        }
+
+        template <typename... Args>
+        explicit Shared(std::in_place_t, Args&&... args)
+            : block_(new Block(std::in_place, std::forward<Args>(args)...))
+        {
+        }
+
+        // NOLINTNEXTLINE -> non-explicit
+        Shared(const T& value) : block_(new Block(std::in_place, value)) {}
+
+        // NOLINTNEXTLINE -> non-explicit
+        Shared(T&& value) : block_(new Block(std::in_place, std::move(value))) {}
+
+        Shared(const Shared& that) : block_(Share(that.block_)) {}
+
+        Shared(Shared&& that) noexcept : block_(std::exchange(that.block_, nullptr)) {}
+
+        Shared& operator=(Shared that) noexcept
+        {
+            std::swap(block_, that.block_);
+            return *this;
+        }
+
+        ~Shared() { Release(); }
+
+        const T& operator*() const { return Get(); }
+        const T* operator->() const { return std::addressof(Get()); }
+
+        T& operator*() { return Detach(); }
+        T* operator->() { return std::addressof(Detach()); }
+
+        // Number of boxes sharing the payload, 0 for a moved-from box
+        std::size_t UseCount() const noexcept
+        {
+            return block_ == nullptr ? 0 : block_->count_.load(std::memory_order_relaxed);
+        }
+
+        friend bool operator==(const Shared& lhs, const Shared& rhs)
+            requires(std::equality_comparable<T>)
+        {
+            return lhs.block_ == rhs.block_ || *lhs == *rhs;
+        }
+
+        friend auto operator<=>(const Shared& lhs, const Shared& rhs)
+            requires(std::three_way_comparable<T>)
+        {
+            return *lhs <=> *rhs;
+        }
+
+    private:
+        static Block* Share(Block* block)
+        {
+            if (block == nullptr)
+            {
+                return nullptr;
+            }
+
+            if (block->unshared_)
+            {
+                return new Block(std::in_place, std::as_const(block->value_));
+            }
+
+            // A new reference is made from an existing one, nothing to synchronize with
+            block->count_.fetch_add(1, std::memory_order_relaxed);
+            return block;
+        }
+
+        const T& Get() const
+        {
+            impl::Check(block_ != nullptr);
+            return block_->value_;
+        }
+
+        T& Detach()
+        {
+            impl::Check(block_ != nullptr);
+
+            // Acquire: the writes of the owners that released their copies happen before ours
+            if (block_->count_.load(std::memory_order_acquire) != 1)
+            {
+                Block* copy = new Block(std::in_place, std::as_const(block_->value_));
+                Release();
+                block_ = copy;
+            }
+
+            // The caller may keep the reference, copies made from now on must not share it
+            block_->unshared_ = true;
+            return block_->value_;
+        }
+
+        void Release() noexcept
+        {
+            if (block_ != nullptr && block_->count_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                delete block_;
+            }
+        }
+
+        Block* block_;
+    };
+
+    namespace impl
+    {
+        template <typename T>
+        constexpr bool kIsBox<Shared<T>> = true;
+    }  // namespace impl
+}  // namespace variantx
+
+template <typename T>
+    requires(std::is_default_constructible_v<std::hash<T>>)
+struct std::hash<variantx::Shared<T>>
+{
+    std::size_t operator()(const variantx::Shared<T>& shared) const
+    {
+        return std::hash<T>()(*shared);
+    }
+};
@@ -0,0 +1,311 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <variantx-scan.hpp>
+#include <variantx.hpp>
+#include <vector>
+
+// clang-format off
+#if __has_include(<execution>)
+    #include <execution>
+#endif
+// clang-format on
+
+/*
+ * Ordering ranges of variants by alternative without comparing them:
+ *
+ * SortByIndex            -> in-place counting sort on Index() (American flag sort), O(n), unstable
+ * StablePartitionByIndex -> the same order, stable, with a buffer of n moved variants
+ * Sort                   -> the order of operator<: SortByIndex, then one std::sort per
+ *                           alternative on the alternative itself, no dispatch in the comparator
+ *
+ * Valueless elements go first, as operator< orders them. Sort also takes an execution policy
+ * where <execution> is available; with libstdc++ the parallel policies need TBB linked.
+ * Sort rejects reference alternatives, SortByIndex and StablePartitionByIndex rebind them.
+ */
+
+namespace variantx
+{
+    namespace impl::sort
+    {
+        template <typename Range>
+        constexpr bool kIsSortableRange =
+            std::ranges::random_access_range<Range> && std::ranges::sized_range<Range> &&
+            kIsVariant<std::ranges::range_value_t<Range>>;
+
+        // 0 for valueless, Index() + 1 otherwise: kVariantNpos wraps to 0
+        template <typename TVariant>
+        constexpr std::size_t Bucket(const TVariant& variant) noexcept
+        {
+            return variant.Index() + 1;
+        }
+
+        // Position where every bucket starts, the last entry is the size of the range
+        template <typename Range>
+        auto BucketStarts(Range& range)
+        {
+            using TVariant = std::ranges::range_value_t<Range>;
+
+            constexpr std::size_t kBuckets = kVariantSizeV<TVariant> + 1;
+
+            std::array<std::size_t, kBuckets + 1> starts{};
+            if constexpr (scan::kIsVariantRange<Range>)
+            {
+                const auto histogram = IndexHistogram(range);
+
+                std::size_t counted = 0;
+                for (std::size_t index = 0; index < histogram.size(); ++index)
+                {
+                    starts[index + 2] = histogram[index];
+                    counted += histogram[index];
+                }
+                starts[1] = std::ranges::size(range) - counted;
+            }
+            else
+            {
+                for (const TVariant& variant : range)
+                {
+                    ++starts[Bucket(variant) + 1];
+                }
+            }
+
+            std::partial_sum(starts.begin(), starts.end(), starts.begin());
+            return starts;
+        }
+
+        // Per-alternative result: where alternative I starts, the last entry is the end
+        template <std::size_t Alternatives, std::size_t Buckets>
+        std::array<std::size_t, Alternatives + 1> AlternativeStarts(
+            const std::array<std::size_t, Buckets>& starts) noexcept
+        {
+            std::array<std::size_t, Alternatives + 1> result;
+            std::copy(starts.begin() + 1, starts.end(), result.begin());
+            return result;
+        }
+
+        /*
+         * Iterator over variants that all hold alternative `Index`, yields the alternative
+         * itself: std::sort compares and swaps the values with no dispatch at all.
+         */
+        template <std::size_t Index, typename Iterator>
+        class AlternativeIterator
+        {
+        public:
+            using iterator_category = std::random_access_iterator_tag;  // NOLINT
+            using value_type        = VariantAlternativeType<  // NOLINT
+                Index, std::remove_cv_t<std::iter_value_t<Iterator>>>;
+            using difference_type = std::iter_difference_t<Iterator>;  // NOLINT
+            using pointer         = value_type*;                       // NOLINT
+            using reference       = value_type&;                       // NOLINT
+
+            AlternativeIterator() = default;
+
+            explicit AlternativeIterator(Iterator iterator) : iterator_(iterator) {}
+
+            reference operator*() const { return GetUnchecked<Index>(*iterator_); }
+
+            pointer operator->() const { return std::addressof(**this); }
+
+            reference operator[](difference_type offset) const { return *(*this + offset); }
+
+            AlternativeIterator& operator++()
+            {
+                ++iterator_;
+                return *this;
+            }
+
+            AlternativeIterator operator++(int)
+            {
+                return AlternativeIterator(iterator_++);
+            }
+
+            AlternativeIterator& operator--()
+            {
+                --iterator_;
+                return *this;
+            }
+
+            AlternativeIterator operator--(int)
+            {
+                return AlternativeIterator(iterator_--);
+            }
+
+            AlternativeIterator& operator+=(difference_type offset)
+            {
+                iterator_ += offset;
+                return *this;
+            }
+
+            AlternativeIterator& operator-=(difference_type offset)
+            {
+                iterator_ -= offset;
+                return *this;
+            }
+
+            friend AlternativeIterator operator+(AlternativeIterator it, difference_type offset)
+            {
+                return it += offset;
+            }
+
+            friend AlternativeIterator operator+(difference_type offset, AlternativeIterator it)
+            {
+                return it += offset;
+            }
+
+            friend AlternativeIterator operator-(AlternativeIterator it, difference_type offset)
+            {
+                return it -= offset;
+            }
+
+            friend difference_type operator-(const AlternativeIterator& lhs,
+                                             const AlternativeIterator& rhs)
+            {
+                return lhs.iterator_ - rhs.iterator_;
+            }
+
+            friend bool operator==(const AlternativeIterator&,
+                                   const AlternativeIterator&) = default;
+
+            friend auto operator<=>(const AlternativeIterator& lhs, const AlternativeIterator& rhs)
+            {
+                return lhs.iterator_ <=> rhs.iterator_;
+            }
+
+        private:
+            Iterator iterator_;
+        };
+
+        template <typename Iterator>
+        Iterator Advance(Iterator first, std::size_t offset)
+        {
+            return first + static_cast<std::iter_difference_t<Iterator>>(offset);
+        }
+
+        template <typename Iterator, typename Starts, typename Sorter, std::size_t... Indices>
+        void SortAlternatives(Iterator first, const Starts& starts, Sorter& sorter,
+                              std::index_sequence<Indices...>)
+        {
+            using TVariant = std::remove_cv_t<std::iter_value_t<Iterator>>;
+
+            // The alternative iterators would swap the referred objects, not the references
+            static_assert(!(std::is_reference_v<VariantAlternativeType<Indices, TVariant>> || ...),
+                          "variantx::Sort does not support reference alternatives.");
+
+            (sorter(AlternativeIterator<Indices, Iterator>(Advance(first, starts[Indices])),
+                    AlternativeIterator<Indices, Iterator>(Advance(first, starts[Indices + 1]))),
+             ...);
+        }
+    }  // namespace impl::sort
+
+    /*
+     * Returns where every alternative starts: alternative I is in [starts[I], starts[I + 1]),
+     * valueless elements are in [0, starts[0]).
+     */
+    template <typename Range>
+        requires(impl::sort::kIsSortableRange<Range>)
+    auto SortByIndex(Range&& range)
+    {
+        using impl::sort::Advance;
+        using impl::sort::Bucket;
+        using TVariant = std::ranges::range_value_t<Range>;
+
+        const auto starts = impl::sort::BucketStarts(range);
+        const auto first  = std::ranges::begin(range);
+
+        // Next unsorted position of every bucket
+        auto next = starts;
+        for (std::size_t bucket = 0; bucket + 1 < starts.size(); ++bucket)
+        {
+            while (next[bucket] < starts[bucket + 1])
+            {
+                const auto        current = Advance(first, next[bucket]);
+                const std::size_t target  = Bucket(*current);
+
+                if (target == bucket)
+                {
+                    ++next[bucket];
+                }
+                else
+                {
+                    std::ranges::iter_swap(current, Advance(first, next[target]++));
+                }
+            }
+        }
+
+        return impl::sort::AlternativeStarts<kVariantSizeV<TVariant>>(starts);
+    }
+
+    // The order of SortByIndex, keeping the relative order of the elements of one alternative
+    template <typename Range>
+        requires(impl::sort::kIsSortableRange<Range> &&
+                 std::is_move_constructible_v<std::ranges::range_value_t<Range>>)
+    auto StablePartitionByIndex(Range&& range)
+    {
+        using impl::sort::Advance;
+        using impl::sort::Bucket;
+        using TVariant = std::ranges::range_value_t<Range>;
+
+        const auto        starts = impl::sort::BucketStarts(range);
+        const std::size_t size   = std::ranges::size(range);
+        const auto        first  = std::ranges::begin(range);
+
+        // source[destination], then every variant is moved out and back exactly once
+        std::vector<std::size_t> source(size);
+        auto                     next = starts;
+        for (std::size_t position = 0; position < size; ++position)
+        {
+            source[next[Bucket(*Advance(first, position))]++] = position;
+        }
+
+        std::vector<TVariant> buffer;
+        buffer.reserve(size);
+        for (const std::size_t position : source)
+        {
+            buffer.push_back(std::move(*Advance(first, position)));
+        }
+        std::ranges::move(buffer, first);
+
+        return impl::sort::AlternativeStarts<kVariantSizeV<TVariant>>(starts);
+    }
+
+    // Sorts as std::sort with operator< would, alternatives are compared with `<` directly
+    template <typename Range>
+        requires(impl::sort::kIsSortableRange<Range>)
+    void Sort(Range&& range)
+    {
+        using TVariant = std::ranges::range_value_t<Range>;
+
+        const auto starts = SortByIndex(range);
+
+        auto sorter = [](auto first, auto last) { std::sort(first, last); };
+        impl::sort::SortAlternatives(std::ranges::begin(range), starts, sorter,
+                                     std::make_index_sequence<kVariantSizeV<TVariant>>());
+    }
+
+#if defined(__cpp_lib_execution)
+    // Every alternative is sorted with `policy`, the index pass is sequential
+    template <typename ExecutionPolicy, typename Range>
+        requires(std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>> &&
+                 impl::sort::kIsSortableRange<Range>)
+    void Sort(ExecutionPolicy&& policy, Range&& range)
+    {
+        using TVariant = std::ranges::range_value_t<Range>;
+
+        const auto starts = SortByIndex(range);
+
+        auto sorter = [&policy](auto first, auto last) { std::sort(policy, first, last); };
+        impl::sort::SortAlternatives(std::ranges::begin(range), starts, sorter,
+                                     std::make_index_sequence<kVariantSizeV<TVariant>>());
+    }
+#endif
+}  // namespace variantx
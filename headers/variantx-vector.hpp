@@ -0,0 +1,212 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variantx-index-array.hpp>
+#include <variantx.hpp>
+#include <vector>
+
+namespace variantx
+{
+    /*
+     * Column oriented sequence of variants (a dense union, as Arrow has):
+     * a bit-packed index and an offset per element, plus one densely packed std::vector per
+     * alternative. An element costs IndexArray::kBits bits + 4 bytes + the size of its own
+     * alternative, instead of the largest alternative plus padding.
+     *
+     * Append only. operator[] returns a VariantRef into the pools, it is invalidated by the
+     * next append of the same alternative, like a reference into a std::vector.
+     */
+    template <typename... Ts>
+    class VariantVector
+    {
+        static_assert(0 < sizeof...(Ts), "VariantVector must have at least one alternative.");
+        static_assert(!(std::is_reference_v<Ts> || ...),
+                      "VariantVector can not have a reference type as an alternative.");
+
+        // std::vector<bool> packs bits, there is no bool object to refer to
+        static_assert(!(std::is_same_v<std::remove_cv_t<Ts>, bool> || ...),
+                      "VariantVector can not have bool as an alternative.");
+
+        template <std::size_t Index>
+        using Alternative = utilities::GetTypeByIndex<Index, Ts...>;
+
+        static constexpr std::size_t kMinCapacity = 16;
+
+    public:
+        using IndexArray     = PackedIndexArray<sizeof...(Ts)>;
+        using OffsetType     = std::uint32_t;
+        using Reference      = VariantRef<Ts...>;
+        using ConstReference = ConstVariantRef<Ts...>;
+
+        VariantVector() = default;
+
+        std::size_t Size() const noexcept { return indices_.Size(); }
+
+        bool Empty() const noexcept { return indices_.Empty(); }
+
+        void Reserve(std::size_t capacity)
+        {
+            indices_.Reserve(capacity);
+            offsets_.reserve(capacity);
+        }
+
+        void Clear() noexcept
+        {
+            indices_.Clear();
+            offsets_.clear();
+            std::apply([](auto&... pools) { (pools.clear(), ...); }, pools_);
+        }
+
+        template <std::size_t Index, typename... Args>
+            requires(Index < sizeof...(Ts) && std::is_constructible_v<Alternative<Index>, Args...>)
+        Alternative<Index>& EmplaceBack(Args&&... args)
+        {
+            auto& pool = std::get<Index>(pools_);
+            if (pool.size() == std::numeric_limits<OffsetType>::max()) [[unlikely]]
+            {
+                impl::LengthError("VariantVector: too many elements of one alternative");
+            }
+
+            // Grown before the element exists, the bookkeeping below can not throw
+            if (offsets_.size() == offsets_.capacity())
+            {
+                Reserve(std::max(2 * offsets_.capacity(), kMinCapacity));
+            }
+
+            auto& value = pool.emplace_back(std::forward<Args>(args)...);
+
+            indices_.PushBack(Index);
+            offsets_.push_back(static_cast<OffsetType>(pool.size() - 1));
+            return value;
+        }
+
+        template <typename T, typename... Args,
+                  std::size_t Index = utilities::FindUnambiguousIndex<T, Ts...>::value>
+            requires(std::is_constructible_v<T, Args...>)
+        T& EmplaceBack(Args&&... args)
+        {
+            return EmplaceBack<Index>(std::forward<Args>(args)...);
+        }
+
+        // The alternative is selected as the converting constructor of Variant<Ts...> does
+        template <typename Arg, typename T = utilities::SelectorType<Arg, Ts...>,
+                  std::size_t Index = utilities::FindUnambiguousIndex<T, Ts...>::value>
+            requires(!std::is_same_v<std::remove_cvref_t<Arg>, Variant<Ts...>> &&
+                     std::is_constructible_v<T, Arg>)
+        void PushBack(Arg&& arg)
+        {
+            EmplaceBack<Index>(std::forward<Arg>(arg));
+        }
+
+        // A valueless variant is checked as Visit does
+        void PushBack(const Variant<Ts...>& variant)
+            requires(std::is_copy_constructible_v<Ts> && ...)
+        {
+            impl::CheckNotValueless(variant);
+
+            constexpr auto kTable = []<std::size_t... Indices>(std::index_sequence<Indices...>)
+            {
+                return std::array<void (*)(VariantVector&, const Variant<Ts...>&),
+                                  sizeof...(Ts)>{
+                    [](VariantVector& self, const Variant<Ts...>& from)
+                    { self.EmplaceBack<Indices>(GetUnchecked<Indices>(from)); }...};
+            }(std::index_sequence_for<Ts...>());
+
+            kTable[variant.Index()](*this, variant);
+        }
+
+        std::size_t Index(std::size_t position) const noexcept { return indices_[position]; }
+
+        const IndexArray& Indices() const noexcept { return indices_; }
+
+        // Position of the first element at or after `from` holding the alternative or
+        // IndexArray::kNotFound
+        template <std::size_t Index>
+            requires(Index < sizeof...(Ts))
+        std::size_t FindFirst(std::size_t from = 0) const noexcept
+        {
+            return indices_.FindFirst(Index, from);
+        }
+
+        // Precondition: position < Size()
+        Reference operator[](std::size_t position) noexcept
+        {
+            return At<Reference>(*this, position);
+        }
+
+        // Precondition: position < Size()
+        ConstReference operator[](std::size_t position) const noexcept
+        {
+            return At<ConstReference>(*this, position);
+        }
+
+        // Elements holding the alternative, in insertion order
+        template <std::size_t Index>
+        std::span<Alternative<Index>> Pool() noexcept
+        {
+            return std::get<Index>(pools_);
+        }
+
+        template <std::size_t Index>
+        std::span<const Alternative<Index>> Pool() const noexcept
+        {
+            return std::get<Index>(pools_);
+        }
+
+        /*
+         * Calls `visitor` for every element, pool after pool: every pool is a contiguous loop
+         * with a statically known type, no dispatch per element. Elements of the same
+         * alternative keep their relative order, different alternatives do not interleave.
+         */
+        template <typename Visitor>
+        void VisitAll(Visitor&& visitor)
+        {
+            std::apply([&visitor](auto&... pools) { (VisitPool(visitor, pools), ...); }, pools_);
+        }
+
+        template <typename Visitor>
+        void VisitAll(Visitor&& visitor) const
+        {
+            std::apply([&visitor](const auto&... pools) { (VisitPool(visitor, pools), ...); },
+                       pools_);
+        }
+
+    private:
+        template <typename Visitor, typename Vector>
+        static void VisitPool(Visitor& visitor, Vector& pool)
+        {
+            for (auto& value : pool)
+            {
+                std::invoke(visitor, value);
+            }
+        }
+
+        template <typename Ref, typename Self>
+        static Ref At(Self& self, std::size_t position) noexcept
+        {
+            constexpr auto kTable = []<std::size_t... Indices>(std::index_sequence<Indices...>)
+            {
+                return std::array<Ref (*)(Self&, std::size_t), sizeof...(Ts)>{
+                    [](Self& from, std::size_t offset) noexcept -> Ref {
+                        return Ref(std::in_place_index<Indices>,
+                                   std::get<Indices>(from.pools_)[offset]);
+                    }...};
+            }(std::index_sequence_for<Ts...>());
+
+            return kTable[self.indices_[position]](self, self.offsets_[position]);
+        }
+
+        IndexArray                     indices_;
+        std::vector<OffsetType>        offsets_;
+        std::tuple<std::vector<Ts>...> pools_;
+    };
+}  // namespace variantx
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <variantx-scan.hpp>
+#include <variantx.hpp>
+
+/*
+ * Range adaptors over ranges of Variant, composable with std::ranges:
+ *
+ * messages | views::alternative<Quote>        -> Quote& of every element holding a Quote
+ * messages | views::alternative_index<1>      -> the same by index
+ * messages | views::indices                   -> Index() of every element
+ * messages | views::visit(visitor)            -> Visit(visitor, element) of every element
+ *
+ * Over a contiguous borrowed range (an lvalue std::vector, std::span, ...) the alternative
+ * adaptors skip non-matching elements with the tag scans of variantx-scan.hpp, other ranges
+ * get std::views::filter + std::views::transform.
+ */
+
+namespace variantx
+{
+    namespace impl::views
+    {
+        // clang-format off
+#if defined(__cpp_lib_ranges) && __cpp_lib_ranges >= 202202L
+        template <typename Derived>
+        using Closure = std::ranges::range_adaptor_closure<Derived>;
+#else
+        // `range | adaptor` only, adaptors do not compose with each other before C++23
+        template <typename Derived>
+        struct Closure
+        {
+            template <typename Range>
+                requires(std::invocable<const Derived&, Range>)
+            friend constexpr auto operator|(Range&& range, const Derived& adaptor)
+            {
+                return adaptor(std::forward<Range>(range));
+            }
+        };
+#endif
+        // clang-format on
+
+        template <std::size_t Index>
+        struct HoldsIndex
+        {
+            template <typename TVariant>
+            constexpr bool operator()(const TVariant& variant) const noexcept
+            {
+                return variant.Index() == Index;
+            }
+        };
+
+        template <std::size_t Index>
+        struct GetIndex
+        {
+            template <typename TVariant>
+            constexpr decltype(auto) operator()(TVariant&& variant) const noexcept
+            {
+                return GetUnchecked<Index>(std::forward<TVariant>(variant));
+            }
+        };
+
+        /*
+         * Elements of a contiguous range holding alternative `Index`. Advancing is a tag scan
+         * from the current position, not a test per element.
+         */
+        template <std::size_t Index, typename TVariant>
+        class AlternativeView : public std::ranges::view_interface<AlternativeView<Index, TVariant>>
+        {
+            using Tags = decltype(scan::Tags(std::declval<std::span<TVariant>>()));
+            using Tag  = std::remove_cvref_t<decltype(std::declval<Tags>().At(0))>;
+
+            static constexpr Tag kTag = scan::Encode<Tag>(Index);
+
+        public:
+            class Iterator
+            {
+                friend class AlternativeView;
+
+                Iterator(TVariant* first, Tags tags, std::size_t position) noexcept
+                    : first_(first), tags_(tags), position_(position)
+                {
+                }
+
+            public:
+                using value_type       = VariantAlternativeType<  // NOLINT
+                    Index, std::remove_cv_t<TVariant>>;
+                using reference        = decltype(GetUnchecked<Index>(  // NOLINT
+                    std::declval<TVariant&>()));
+                using difference_type  = std::ptrdiff_t;            // NOLINT
+                using iterator_concept = std::forward_iterator_tag;  // NOLINT
+
+                Iterator() = default;
+
+                reference operator*() const noexcept
+                {
+                    return GetUnchecked<Index>(first_[position_]);  // NOLINT
+                }
+
+                Iterator& operator++() noexcept
+                {
+                    position_ = Next(tags_, position_ + 1);
+                    return *this;
+                }
+
+                Iterator operator++(int) noexcept
+                {
+                    Iterator old = *this;
+                    ++*this;
+                    return old;
+                }
+
+                // Position of the element in the underlying range
+                std::size_t Position() const noexcept { return position_; }
+
+                friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept
+                {
+                    return lhs.position_ == rhs.position_;
+                }
+
+                friend bool operator==(const Iterator& it, std::default_sentinel_t) noexcept
+                {
+                    return it.position_ == it.tags_.count_;
+                }
+
+            private:
+                TVariant*   first_    = nullptr;
+                Tags        tags_     = {};
+                std::size_t position_ = 0;
+            };
+
+            AlternativeView() = default;
+
+            explicit AlternativeView(std::span<TVariant> variants) noexcept
+                : variants_(variants), tags_(scan::Tags(variants))
+            {
+            }
+
+            Iterator begin() const noexcept  // NOLINT
+            {
+                return Iterator(variants_.data(), tags_, Next(tags_, 0));
+            }
+
+            std::default_sentinel_t end() const noexcept { return {}; }  // NOLINT
+
+        private:
+            static std::size_t Next(const Tags& tags, std::size_t from) noexcept
+            {
+                const std::size_t found = scan::Find(tags, kTag, from);
+                return found == kVariantNpos ? tags.count_ : found;
+            }
+
+            std::span<TVariant> variants_;
+            Tags                tags_ = {};
+        };
+
+        template <std::size_t Index>
+        struct ByIndex
+        {
+            template <typename TVariant>
+            static constexpr std::size_t kIndex = Index;
+        };
+
+        template <typename T>
+        struct ByType
+        {
+            template <typename TVariant>
+            static constexpr std::size_t kIndex = scan::IndexOf<T, TVariant>::value;
+        };
+
+        template <typename Selector>
+        struct AlternativeAdaptor : Closure<AlternativeAdaptor<Selector>>
+        {
+            template <std::ranges::viewable_range Range>
+                requires(kIsVariant<std::ranges::range_value_t<Range>>)
+            constexpr auto operator()(Range&& range) const
+            {
+                using TVariant = std::ranges::range_value_t<Range>;
+
+                constexpr std::size_t kIndex = Selector::template kIndex<TVariant>;
+
+                if constexpr (std::ranges::contiguous_range<Range> &&
+                              std::ranges::sized_range<Range> &&
+                              std::ranges::borrowed_range<Range>)
+                {
+                    using Element = std::remove_reference_t<std::ranges::range_reference_t<Range>>;
+                    return AlternativeView<kIndex, Element>(std::span<Element>(range));
+                }
+                else
+                {
+                    return std::forward<Range>(range) | std::views::filter(HoldsIndex<kIndex>()) |
+                           std::views::transform(GetIndex<kIndex>());
+                }
+            }
+        };
+
+        struct IndexProjection
+        {
+            template <typename TVariant>
+            constexpr std::size_t operator()(const TVariant& variant) const noexcept
+            {
+                return variant.Index();
+            }
+        };
+
+        template <typename Visitor>
+        struct VisitProjection
+        {
+            template <typename TVariant>
+            constexpr decltype(auto) operator()(TVariant&& variant) const
+            {
+                return Visit(visitor_, std::forward<TVariant>(variant));
+            }
+
+            Visitor visitor_;
+        };
+    }  // namespace impl::views
+
+    namespace views
+    {
+        // NOLINTBEGIN -> std::views naming
+        template <typename T>
+        inline constexpr impl::views::AlternativeAdaptor<impl::views::ByType<T>> alternative{};
+
+        template <std::size_t Index>
+        inline constexpr impl::views::AlternativeAdaptor<impl::views::ByIndex<Index>>
+            alternative_index{};
+
+        inline constexpr auto indices = std::views::transform(impl::views::IndexProjection());
+
+        template <typename Visitor>
+        constexpr auto visit(Visitor&& visitor)
+        {
+            return std::views::transform(impl::views::VisitProjection<std::decay_t<Visitor>>{
+                std::forward<Visitor>(visitor)});
+        }
+        // NOLINTEND
+    }  // namespace views
+}  // namespace variantx
+
+namespace std::ranges
+{
+    // Iterators point into the underlying range, not into the view
+    template <std::size_t Index, typename TVariant>
+    inline constexpr bool
+        enable_borrowed_range<variantx::impl::views::AlternativeView<Index, TVariant>> = true;
+}  // namespace std::ranges
@@ -1,15 +1,25 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <compare>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <expected>
 #include <functional>
 #include <fwd/variantx.hpp>
 #include <initializer_list>
 #include <sfinae_helperx.hpp>
+#include <span>
 #include <type_traits>
 #include <utilities.hpp>
+#include <variantx-access-result.hpp>
+#include <variantx-checks.hpp>
 #include <variantx-exceptions.hpp>
+#include <variantx-recursive.hpp>
+#include <variantx-shared.hpp>
+#include <vector>
 
 namespace variantx
 {
@@ -40,6 +50,35 @@ namespace variantx
         static constexpr std::size_t kValue = sizeof...(Ts);
     };
 
+    /*
+     * Opt-in: Emplace on the alternative the variant already holds assigns to it instead of
+     * destroy + construct, so heap buffers (capacity) of the held value are reused.
+     * Reset() calls clear() on such alternatives if they have it.
+     *
+     * Specialize with kValue = true for your types.
+     */
+    template <typename T>
+    struct ReuseStorage
+    {
+        static constexpr bool kValue = false;
+    };
+
+    template <typename T>
+    struct ReuseStorage<const T>
+    {
+        static constexpr bool kValue = false;
+    };
+
+    /*
+     * Empty alternative, e.g. the first one of a variant whose alternatives are not default
+     * constructible. All Monostates are equal.
+     */
+    struct Monostate
+    {
+        friend constexpr bool operator==(Monostate, Monostate) noexcept = default;
+        friend constexpr std::strong_ordering operator<=>(Monostate, Monostate) noexcept = default;
+    };
+
     namespace impl
     {
         template <typename... Ts>
@@ -90,6 +129,48 @@ namespace variantx
         {
         };
 
+        // Construct the alternative from the result of a callable
+        struct FactoryTag
+        {
+        };
+
+        template <typename T, typename... Args>
+        constexpr bool kAssignInPlace = false;
+
+        template <typename T, typename Arg>
+        constexpr bool kAssignInPlace<T, Arg> =
+            ReuseStorage<T>::kValue && std::is_assignable_v<T&, Arg>;
+
+        // Reference alternatives are rebound on assignment, never assigned through
+        template <typename T, typename Arg>
+        constexpr bool kAssignable = std::is_reference_v<T> || std::is_assignable_v<T&, Arg>;
+
+        template <typename T, typename Arg>
+        constexpr bool kNothrowAssignable =
+            std::is_reference_v<T> || std::is_nothrow_assignable_v<T&, Arg>;
+
+        // Reference alternatives are stored as pointers
+        template <typename T>
+        using Stored = std::conditional_t<std::is_reference_v<T>, std::remove_reference_t<T>*, T>;
+
+        // Reference alternatives bind lvalues only, a temporary would dangle
+        template <typename T, typename... Args>
+        constexpr bool kConstructible = std::is_constructible_v<T, Args...>;
+
+        template <typename T, typename Arg>
+        constexpr bool kConstructible<T&, Arg> =
+            std::is_lvalue_reference_v<Arg> && std::is_convertible_v<Arg, T&>;
+
+        // Same type prvalue is always fine (guaranteed copy elision), even for immovable types.
+        template <typename Factory, typename T>
+        concept FactoryFor =
+            std::is_invocable_v<Factory> &&
+            (std::is_reference_v<T>
+                 ? kConstructible<T, std::invoke_result_t<Factory>>
+                 : (std::is_same_v<std::remove_cv_t<std::invoke_result_t<Factory>>,
+                                   std::remove_cv_t<T>> ||
+                    std::is_constructible_v<T, std::invoke_result_t<Factory>>));
+
         // Order and value matters
         enum class Trait : std::uint8_t
         {
@@ -102,8 +183,8 @@ namespace variantx
         template <typename T,
                   template <typename> typename IsTriviallyAvailable,
                   template <typename> typename IsAvailable>
-        constexpr Trait kTrait = IsTriviallyAvailable<T>::value ? Trait::TriviallyAvailable
-                                 : IsAvailable<T>::value ? Trait::Available // NOLINT
+        constexpr Trait kTrait = IsTriviallyAvailable<Stored<T>>::value ? Trait::TriviallyAvailable
+                                 : IsAvailable<Stored<T>>::value ? Trait::Available // NOLINT
                                  : Trait::Unavailable;
         // clang-format on
 
@@ -138,6 +219,25 @@ namespace variantx
 
         namespace access
         {
+            struct Alternative
+            {
+                // T& for reference alternatives, the value category of `alternative` otherwise
+                template <typename TAlternative>
+                static constexpr decltype(auto) Value(TAlternative&& alternative) noexcept
+                {
+                    using T = typename std::remove_cvref_t<TAlternative>::ValueType;
+
+                    if constexpr (std::is_reference_v<T>)
+                    {
+                        return static_cast<T&>(*alternative.pointer_);
+                    }
+                    else
+                    {
+                        return (std::forward<TAlternative>(alternative).value_);
+                    }
+                }
+            };
+
             struct VariadicUnion
             {
                 template <typename TVariadicUnion>
@@ -166,6 +266,18 @@ namespace variantx
                     return VariadicUnion::GetAlternative(std::forward<TBase>(base).variadic_union_,
                                                          std::in_place_index_t<Index>());
                 }
+
+                template <typename TBase>
+                static constexpr auto* Storage(TBase& base) noexcept
+                {
+                    return std::addressof(base.variadic_union_);
+                }
+
+                template <typename TBase>
+                static constexpr auto* Discriminator(TBase& base) noexcept
+                {
+                    return std::addressof(base.index_);
+                }
             };
 
             struct Variant
@@ -175,6 +287,20 @@ namespace variantx
                 {
                     return Base::GetAlternative<Index>(std::forward<TVariant>(variant).impl_);
                 }
+
+                // Address of the storage, every alternative lives at this address.
+                template <typename TVariant>
+                static constexpr auto* Storage(TVariant& variant) noexcept
+                {
+                    return Base::Storage(variant.impl_);
+                }
+
+                // Address of the stored index, the maximum of IndexType stands for valueless.
+                template <typename TVariant>
+                static constexpr auto* Discriminator(TVariant& variant) noexcept
+                {
+                    return Base::Discriminator(variant.impl_);
+                }
             };
         }  // namespace access
 
@@ -465,10 +591,12 @@ namespace variantx
                     {
                         VisitExhaustiveVisitorCheck<
                             Visitor,
-                            decltype((std::forward<Alternatives>(alternatives).value_))...>();
+                            decltype(Unbox(access::Alternative::Value(
+                                std::forward<Alternatives>(alternatives))))...>();
 
                         return std::invoke(std::forward<Visitor>(visitor_),
-                                           std::forward<Alternatives>(alternatives).value_...);
+                                           Unbox(access::Alternative::Value(
+                                               std::forward<Alternatives>(alternatives)))...);
                     }
 
                     Visitor&& visitor_;  // NOLINT -> ref data member
@@ -482,17 +610,20 @@ namespace variantx
                     {
                         VisitExhaustiveVisitorCheck<
                             Visitor,
-                            decltype((std::forward<Alternatives>(alternatives).value_))...>();
+                            decltype(Unbox(access::Alternative::Value(
+                                std::forward<Alternatives>(alternatives))))...>();
 
                         if constexpr (std::is_void_v<Ret>)
                         {
                             std::invoke(std::forward<Visitor>(visitor_),
-                                        std::forward<Alternatives>(alternatives).value_...);
+                                        Unbox(access::Alternative::Value(
+                                            std::forward<Alternatives>(alternatives)))...);
                         }
                         else
                         {
                             return std::invoke(std::forward<Visitor>(visitor_),
-                                               std::forward<Alternatives>(alternatives).value_...);
+                                               Unbox(access::Alternative::Value(
+                                                   std::forward<Alternatives>(alternatives)))...);
                         }
                     }
 
@@ -526,9 +657,42 @@ namespace variantx
             {
             }
 
+            template <typename Factory>
+            // NOLINTNEXTLINE -> unnamed parameter
+            explicit constexpr Alternative(std::in_place_t, FactoryTag, Factory&& factory)
+                : value_(std::forward<Factory>(factory)())  // guaranteed copy elision
+            {
+            }
+
             ValueType value_;
         };
 
+        // Stored as a pointer: trivially copyable and assignment rebinds
+        template <std::size_t Index, typename T>
+        struct Alternative<Index, T&>
+        {
+            using ValueType                     = T&;
+            static constexpr std::size_t kIndex = Index;
+
+            // NOLINTNEXTLINE -> unnamed parameter
+            explicit constexpr Alternative(std::in_place_t, T& value) noexcept
+                : pointer_(std::addressof(value))
+            {
+            }
+
+            // NOLINTNEXTLINE -> unnamed parameter
+            explicit constexpr Alternative(std::in_place_t, std::remove_const_t<T>&&) = delete;
+
+            template <typename Factory>
+            // NOLINTNEXTLINE -> unnamed parameter
+            explicit constexpr Alternative(std::in_place_t, FactoryTag, Factory&& factory)
+                : pointer_(std::addressof(static_cast<T&>(std::forward<Factory>(factory)())))
+            {
+            }
+
+            T* pointer_;
+        };
+
         template <Trait TraitType, std::size_t Index, typename... Ts>
         union VariadicUnion;
 
@@ -592,6 +756,12 @@ namespace variantx
         #undef VARIANTX_VARIADIC_UNION
         // clang-format on
 
+        // Smallest unsigned type for the indices [0, Size) and the valueless state (its max)
+        template <std::size_t Size>
+        using CompactIndex =
+            std::conditional_t<(Size < UINT8_MAX), std::uint8_t,
+                               std::conditional_t<(Size < UINT16_MAX), std::uint16_t, std::size_t>>;
+
         template <Trait Trait, typename... Ts>
         class Base
         {
@@ -599,23 +769,28 @@ namespace variantx
             friend struct visitation::Base;
 
         public:
-            using IndexType = std::size_t;
+            using IndexType = CompactIndex<sizeof...(Ts)>;
 
-            explicit constexpr Base(ValuelessTag tag) : index_(kVariantNpos), variadic_union_(tag)
+            explicit constexpr Base(ValuelessTag tag)
+                : index_(static_cast<IndexType>(kVariantNpos)), variadic_union_(tag)
             {
             }
 
             template <std::size_t Index, typename... Args>
             // NOLINTNEXTLINE -> unnamed parameter
             explicit constexpr Base([[maybe_unused]] std::in_place_index_t<Index>, Args&&... args)
-                : index_(Index),
+                : index_(static_cast<IndexType>(Index)),
                   variadic_union_(std::in_place_index_t<Index>(), std::forward<Args>(args)...)
             {
             }
 
             constexpr bool ValuelessByException() const noexcept { return Index() == kVariantNpos; }
 
-            constexpr std::size_t Index() const noexcept { return index_; }
+            // Max of IndexType wraps to 0 and back to kVariantNpos, no branch
+            constexpr std::size_t Index() const noexcept
+            {
+                return static_cast<std::size_t>(static_cast<IndexType>(index_ + 1)) - 1;
+            }
 
         protected:  // NOLINT -> for readability
             template <typename Self>
@@ -626,8 +801,13 @@ namespace variantx
 
             static constexpr std::size_t Size() noexcept { return sizeof...(Ts); }
 
+            constexpr void SetIndex(std::size_t index) noexcept
+            {
+                index_ = static_cast<IndexType>(index);
+            }
+
         protected:                                           // NOLINT -> for readability
-            std::size_t                    index_;           // NOLINT
+            IndexType                      index_;           // NOLINT
             VariadicUnion<Trait, 0, Ts...> variadic_union_;  // NOLINT
         };
 
@@ -667,7 +847,7 @@ namespace variantx
             constexpr ~Dtor() = default,
             constexpr void Destroy() noexcept
             {
-                this->index_ = kVariantNpos;
+                this->SetIndex(kVariantNpos);
             } VARIANTX_EAT_SEMICOLON);
 
         // Generating Non-Trivially Destructible Dtor version
@@ -685,7 +865,7 @@ namespace variantx
                     }, *this);
                 }
 
-                this->index_ = kVariantNpos;
+                this->SetIndex(kVariantNpos);
             } VARIANTX_EAT_SEMICOLON);
 
         // Generating Non-Destructible Dtor version
@@ -723,11 +903,12 @@ namespace variantx
                             std::construct_at(
                                 std::addressof(lhs.variadic_union_),
                                 std::in_place_index<std::decay_t<decltype(rhs_alt)>::kIndex>,
-                                std::forward<decltype(rhs_alt)>(rhs_alt).value_);
+                                access::Alternative::Value(
+                                    std::forward<decltype(rhs_alt)>(rhs_alt)));
                         },
                         std::forward<Rhs>(rhs));
 
-                    lhs.index_ = rhs_index;
+                    lhs.SetIndex(rhs_index);
                 }
             }
         };
@@ -819,21 +1000,84 @@ namespace variantx
             template <std::size_t Index, typename... Args>
             constexpr auto& Emplace(Args&&... args)
             {
+                using T = AlternativeType<Index>;
+                if constexpr (kAssignInPlace<T, Args...>)
+                {
+                    // Opt-in via ReuseStorage<T>, keeps heap buffers of the held value
+                    if (this->Index() == Index)
+                    {
+                        auto& value = access::Base::GetAlternative<Index>(*this).value_;
+                        value       = (std::forward<Args>(args), ...);
+                        return value;
+                    }
+                }
+
                 this->Destroy();
                 std::construct_at(std::addressof(this->variadic_union_),
                                   std::in_place_index_t<Index>(), std::forward<Args>(args)...);
 
-                this->index_ = Index;
-                return access::Base::GetAlternative<Index>(*this).value_;
+                this->SetIndex(Index);
+                return access::Alternative::Value(access::Base::GetAlternative<Index>(*this));
+            }
+
+            template <std::size_t Index, typename Factory>
+            constexpr auto& EmplaceWith(Factory&& factory)
+            {
+                return Emplace<Index>(FactoryTag(), std::forward<Factory>(factory));
+            }
+
+            template <std::size_t Index, typename Arg>
+            constexpr auto& EmplaceOrAssign(Arg&& arg)
+            {
+                // Reference alternatives rebind, Emplace does exactly that
+                if constexpr (!std::is_reference_v<AlternativeType<Index>>)
+                {
+                    if (this->Index() == Index)
+                    {
+                        auto& value = access::Base::GetAlternative<Index>(*this).value_;
+                        value       = std::forward<Arg>(arg);
+                        return value;
+                    }
+                }
+
+                return Emplace<Index>(std::forward<Arg>(arg));
+            }
+
+            template <std::size_t Index>
+            constexpr auto& Reset()
+            {
+                using T = AlternativeType<Index>;
+                if constexpr (ReuseStorage<T>::kValue && requires(T& value) { value.clear(); })
+                {
+                    if (this->Index() == Index)
+                    {
+                        auto& value = access::Base::GetAlternative<Index>(*this).value_;
+                        value.clear();
+                        return value;
+                    }
+                }
+
+                return Emplace<Index>();
             }
 
         protected:
+            template <std::size_t Index>
+            using AlternativeType = typename std::remove_cvref_t<decltype(
+                access::Base::GetAlternative<Index>(std::declval<Assignment&>()))>::ValueType;
+
             template <std::size_t Index, typename T, typename Arg>
             constexpr void AssignAlternative(Alternative<Index, T>& alternative, Arg&& arg)
             {
                 if (this->Index() == Index)
                 {
-                    alternative.value_ = std::forward<Arg>(arg);
+                    if constexpr (std::is_reference_v<T>)
+                    {
+                        alternative = Alternative<Index, T>(std::in_place, std::forward<Arg>(arg));
+                    }
+                    else
+                    {
+                        alternative.value_ = std::forward<Arg>(arg);
+                    }
                 }
                 else
                 {
@@ -848,6 +1092,8 @@ namespace variantx
                         // NOLINTNEXTLINE -> unnamed parameter
                         constexpr void operator()(std::false_type) const
                         {
+                            // The temporary is the strong guarantee: the conversion may throw,
+                            // so it has to happen before Destroy(). EmplaceWith can't help here.
                             this_->Emplace<Index>(T(std::forward<Arg>(arg_)));
                         }
 
@@ -855,7 +1101,9 @@ namespace variantx
                         Arg&&       arg_;   // NOLINT -> public visibility
                     } impl{this, std::forward<Arg>(arg)};
 
-                    impl(std::bool_constant<std::is_nothrow_constructible_v<T, Arg> ||
+                    // Constructing a temporary first only matters if the conversion can throw.
+                    impl(std::bool_constant<!VARIANTX_HAS_EXCEPTIONS ||
+                                            std::is_nothrow_constructible_v<T, Arg> ||
                                             !std::is_nothrow_move_constructible_v<T>>());
                 }
             }
@@ -879,7 +1127,8 @@ namespace variantx
                         {
                             this->AssignAlternative(
                                 this_alternative,
-                                std::forward<decltype(that_alternative)>(that_alternative).value_);
+                                access::Alternative::Value(
+                                    std::forward<decltype(that_alternative)>(that_alternative)));
                         },
                         *this, std::forward<That>(that));
                 }
@@ -999,7 +1248,16 @@ namespace variantx
                         [](auto& this_alt, auto& that_alt)
                         {
                             using std::swap;
-                            swap(this_alt.value_, that_alt.value_);
+                            using T = typename std::remove_cvref_t<decltype(this_alt)>::ValueType;
+
+                            if constexpr (std::is_reference_v<T>)
+                            {
+                                swap(this_alt.pointer_, that_alt.pointer_);
+                            }
+                            else
+                            {
+                                swap(this_alt.value_, that_alt.value_);
+                            }
                         },
                         *this, that);
                 }
@@ -1014,12 +1272,14 @@ namespace variantx
                     }
 
                     Impl tmp(std::move(*rhs));
-                    if constexpr (std::conjunction_v<std::is_nothrow_move_constructible<Ts>...>)
+                    if constexpr (!VARIANTX_HAS_EXCEPTIONS ||
+                                  std::conjunction_v<std::is_nothrow_move_constructible<Ts>...>)
                     {
                         this->GenericConstruct(*rhs, std::move(*lhs));
                     }
                     else
                     {
+#if VARIANTX_HAS_EXCEPTIONS
                         try
                         {
                             this->GenericConstruct(*rhs, std::move(*lhs));
@@ -1033,6 +1293,7 @@ namespace variantx
 
                             throw;
                         }
+#endif
                     }
 
                     this->GenericConstruct(*lhs, std::move(tmp));
@@ -1066,19 +1327,23 @@ namespace variantx
 
     template <typename... Ts>
     class Variant
-        : private SfinaeCtorBase<std::conjunction_v<std::is_copy_constructible<Ts>...>,
-                                 std::conjunction_v<std::is_move_constructible<Ts>...>>,
-          private SfinaeAssignBase<
-              ((std::is_copy_constructible_v<Ts> && std::is_copy_assignable_v<Ts>) && ...),
-              ((std::is_move_constructible_v<Ts> && std::is_move_assignable_v<Ts>) && ...)>
+        : private SfinaeCtorBase<
+              std::conjunction_v<std::is_copy_constructible<impl::Stored<Ts>>...>,
+              std::conjunction_v<std::is_move_constructible<impl::Stored<Ts>>...>>,
+          private SfinaeAssignBase<((std::is_copy_constructible_v<impl::Stored<Ts>> &&
+                                     std::is_copy_assignable_v<impl::Stored<Ts>>) &&
+                                    ...),
+                                   ((std::is_move_constructible_v<impl::Stored<Ts>> &&
+                                     std::is_move_assignable_v<impl::Stored<Ts>>) &&
+                                    ...)>
     {
         static_assert(0 < sizeof...(Ts), "variant must consist of at least one alternative.");
 
         static_assert(!std::conjunction_v<std::is_array<Ts>...>,
                       "variant can not have an array type as an alternative.");
 
-        static_assert(!std::conjunction_v<std::is_reference<Ts>...>,
-                      "variant can not have a reference type as an alternative.");
+        static_assert(!std::disjunction_v<std::is_rvalue_reference<Ts>...>,
+                      "variant can not have an rvalue reference type as an alternative.");
 
         static_assert(!std::conjunction_v<std::is_void<Ts>...>,
                       "variant can not have a void type as an alternative.");
@@ -1106,7 +1371,7 @@ namespace variantx
                 !std::is_same_v<std::remove_cvref_t<Arg>, Variant> &&
                 !utilities::IsInplaceType<std::remove_cvref_t<Arg>>::value &&
                 !utilities::IsInplaceIndex<std::remove_cvref_t<Arg>>::value &&
-                std::is_constructible_v<T, Arg>
+                impl::kConstructible<T, Arg>
             )
         constexpr Variant(Arg&& arg) noexcept(std::is_nothrow_constructible_v<T, Arg>) // NOLINT -> non-explicit
             : impl_(std::in_place_index_t<Index>(), std::forward<Arg>(arg))
@@ -1120,7 +1385,7 @@ namespace variantx
                   typename = std::enable_if_t<(Index < sizeof...(Ts)), int>,
                   typename T = VariantAlternativeType<Index, Variant<Ts...>>>
             requires (
-                std::is_constructible_v<T, Args...>
+                impl::kConstructible<T, Args...>
             )
         // NOLINTNEXTLINE -> unnamed parameter
         explicit constexpr Variant([[maybe_unused]] std::in_place_index_t<Index>, Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>)
@@ -1136,7 +1401,7 @@ namespace variantx
                   typename = std::enable_if_t<(Index < sizeof...(Ts)), int>,
                   typename T = VariantAlternativeType<Index, Variant<Ts...>>>
             requires(
-                std::is_constructible_v<T, std::initializer_list<U>&, Args...>
+                impl::kConstructible<T, std::initializer_list<U>&, Args...>
             )
         // NOLINTNEXTLINE -> unnamed parameter
         explicit constexpr Variant([[maybe_unused]] std::in_place_index_t<Index>,
@@ -1152,7 +1417,7 @@ namespace variantx
                   typename... Args,
                   std::size_t Index = utilities::FindUnambiguousIndex<T, Ts...>::value>
             requires (
-                std::is_constructible_v<T, Args...>
+                impl::kConstructible<T, Args...>
             )
         // NOLINTNEXTLINE -> unnamed parameter
         explicit constexpr Variant([[maybe_unused]] std::in_place_type_t<T>, Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>)
@@ -1167,7 +1432,7 @@ namespace variantx
                   typename... Args,
                   std::size_t Index = utilities::FindUnambiguousIndex<T, Ts...>::value>
             requires (
-                std::is_constructible_v<T, std::initializer_list<U>&, Args...>
+                impl::kConstructible<T, std::initializer_list<U>&, Args...>
             )
         // NOLINTNEXTLINE -> unnamed parameter
         explicit constexpr Variant([[maybe_unused]] std::in_place_type_t<T>,
@@ -1189,11 +1454,11 @@ namespace variantx
                   std::size_t Index = utilities::FindUnambiguousIndex<T, Ts...>::value>
             requires (
                 !std::is_same_v<Variant, std::remove_cvref_t<Arg>> &&
-                std::is_assignable_v<T&, Arg> &&
-                std::is_constructible_v<T, Arg>
+                impl::kAssignable<T, Arg> &&
+                impl::kConstructible<T, Arg>
             )
         constexpr Variant& operator=(Arg&& arg) noexcept(
-            std::is_nothrow_assignable_v<T&, Arg> &&
+            impl::kNothrowAssignable<T, Arg> &&
             std::is_nothrow_constructible_v<T, Arg>
         )
         {
@@ -1208,7 +1473,7 @@ namespace variantx
                   typename T = VariantAlternativeType<Index, Variant<Ts...>>>
             requires (
                 Index < sizeof...(Ts) &&
-                std::is_constructible_v<T, Args...>
+                impl::kConstructible<T, Args...>
             )
         constexpr T& Emplace(Args&&... args)
         {
@@ -1223,7 +1488,7 @@ namespace variantx
                   typename T = VariantAlternativeType<Index, Variant<Ts...>>>
             requires (
                 Index < sizeof...(Ts) &&
-                std::is_constructible_v<T, std::initializer_list<U>&, Args...>
+                impl::kConstructible<T, std::initializer_list<U>&, Args...>
             )
         constexpr T& Emplace(std::initializer_list<U> list, Args&&... args)
         {
@@ -1236,7 +1501,7 @@ namespace variantx
                   typename... Args,
                   std::size_t Index = utilities::FindUnambiguousIndex<T, Ts...>::value>
             requires (
-                std::is_constructible_v<T, Args...>
+                impl::kConstructible<T, Args...>
             )
         constexpr T& Emplace(Args&&... args)
         {
@@ -1250,7 +1515,7 @@ namespace variantx
                   typename... Args,
                   std::size_t Index = utilities::FindUnambiguousIndex<T, Ts...>::value>
             requires (
-                std::is_constructible_v<T, std::initializer_list<U>&, Args...>
+                impl::kConstructible<T, std::initializer_list<U>&, Args...>
             )
         constexpr T& Emplace(std::initializer_list<U>& list, Args&&... args)
         {
@@ -1258,6 +1523,101 @@ namespace variantx
         }
         // clang-format on
 
+        /*
+         * Assigns if the variant already holds the alternative, emplaces otherwise.
+         */
+
+        // clang-format off
+        template <std::size_t Index,
+                  typename Arg,
+                  typename T = VariantAlternativeType<Index, Variant<Ts...>>>
+            requires (
+                Index < sizeof...(Ts) &&
+                impl::kConstructible<T, Arg> &&
+                impl::kAssignable<T, Arg>
+            )
+        constexpr T& EmplaceOrAssign(Arg&& arg)
+        {
+            return impl_.template EmplaceOrAssign<Index>(std::forward<Arg>(arg));
+        }
+        // clang-format on
+
+        // clang-format off
+        template <typename T,
+                  typename Arg,
+                  std::size_t Index = utilities::FindUnambiguousIndex<T, Ts...>::value>
+            requires (
+                impl::kConstructible<T, Arg> &&
+                impl::kAssignable<T, Arg>
+            )
+        constexpr T& EmplaceOrAssign(Arg&& arg)
+        {
+            return impl_.template EmplaceOrAssign<Index>(std::forward<Arg>(arg));
+        }
+        // clang-format on
+
+        /*
+         * Holds a default constructed alternative afterwards. If it is already held and
+         * ReuseStorage<T> is enabled, clear() is used instead when available.
+         */
+
+        // clang-format off
+        template <std::size_t Index,
+                  typename T = VariantAlternativeType<Index, Variant<Ts...>>>
+            requires (
+                Index < sizeof...(Ts) &&
+                std::is_default_constructible_v<T>
+            )
+        constexpr T& Reset()
+        {
+            return impl_.template Reset<Index>();
+        }
+        // clang-format on
+
+        // clang-format off
+        template <typename T,
+                  std::size_t Index = utilities::FindUnambiguousIndex<T, Ts...>::value>
+            requires (
+                std::is_default_constructible_v<T>
+            )
+        constexpr T& Reset()
+        {
+            return impl_.template Reset<Index>();
+        }
+        // clang-format on
+
+        /*
+         * Constructs the alternative directly from the prvalue returned by `factory()`,
+         * no temporary and no move even for immovable types.
+         */
+
+        // clang-format off
+        template <std::size_t Index,
+                  typename Factory,
+                  typename T = VariantAlternativeType<Index, Variant<Ts...>>>
+            requires (
+                Index < sizeof...(Ts) &&
+                impl::FactoryFor<Factory, T>
+            )
+        constexpr T& EmplaceWith(Factory&& factory)
+        {
+            return impl_.template EmplaceWith<Index>(std::forward<Factory>(factory));
+        }
+        // clang-format on
+
+        // clang-format off
+        template <typename T,
+                  typename Factory,
+                  std::size_t Index = utilities::FindUnambiguousIndex<T, Ts...>::value>
+            requires (
+                impl::FactoryFor<Factory, T>
+            )
+        constexpr T& EmplaceWith(Factory&& factory)
+        {
+            return impl_.template EmplaceWith<Index>(std::forward<Factory>(factory));
+        }
+        // clang-format on
+
         constexpr bool ValuelessByException() const noexcept
         {
             return impl_.ValuelessByException();
@@ -1302,12 +1662,20 @@ namespace variantx
         constexpr auto&& GenericGet(TVariant&& variant)
         {
             using impl::access::Variant;
-            if (!impl::HoldsAlternative<Index>(variant))
-            {
-                throw BadVariantAccess();
-            }
+            impl::Check(impl::HoldsAlternative<Index>(variant));
+
+            return access::Alternative::Value(
+                Variant::GetAlternative<Index>(std::forward<TVariant>(variant)));
+        }
+
+        template <std::size_t Index, typename TVariant>
+        constexpr auto&& GenericGetUnchecked(TVariant&& variant) noexcept
+        {
+            using impl::access::Variant;
+            impl::Assume(impl::HoldsAlternative<Index>(variant));
 
-            return Variant::GetAlternative<Index>(std::forward<TVariant>(variant)).value_;
+            return access::Alternative::Value(
+                Variant::GetAlternative<Index>(std::forward<TVariant>(variant)));
         }
     }  // namespace impl
 
@@ -1377,6 +1745,78 @@ namespace variantx
         return variantx::Get<utilities::FindExactlyOne<T, Ts...>>(std::move(variant));
     }
 
+    /*
+     * Precondition: the variant holds the alternative. Not checked in any VARIANTX_CHECKS mode.
+     */
+
+    template <std::size_t Index, typename... Ts>
+    constexpr VariantAlternativeType<Index, Variant<Ts...>>& GetUnchecked(
+        Variant<Ts...>& variant) noexcept
+    {
+        static_assert(Index < sizeof...(Ts));
+        static_assert(!std::is_void_v<VariantAlternativeType<Index, Variant<Ts...>>>);
+
+        return impl::GenericGetUnchecked<Index>(variant);
+    }
+
+    template <std::size_t Index, typename... Ts>
+    constexpr VariantAlternativeType<Index, Variant<Ts...>>&& GetUnchecked(
+        Variant<Ts...>&& variant) noexcept
+    {
+        static_assert(Index < sizeof...(Ts));
+        static_assert(!std::is_void_v<VariantAlternativeType<Index, Variant<Ts...>>>);
+
+        return impl::GenericGetUnchecked<Index>(std::move(variant));
+    }
+
+    template <std::size_t Index, typename... Ts>
+    constexpr const VariantAlternativeType<Index, Variant<Ts...>>& GetUnchecked(
+        const Variant<Ts...>& variant) noexcept
+    {
+        static_assert(Index < sizeof...(Ts));
+        static_assert(!std::is_void_v<VariantAlternativeType<Index, Variant<Ts...>>>);
+
+        return impl::GenericGetUnchecked<Index>(variant);
+    }
+
+    template <std::size_t Index, typename... Ts>
+    constexpr const VariantAlternativeType<Index, Variant<Ts...>>&& GetUnchecked(
+        const Variant<Ts...>&& variant) noexcept
+    {
+        static_assert(Index < sizeof...(Ts));
+        static_assert(!std::is_void_v<VariantAlternativeType<Index, Variant<Ts...>>>);
+
+        return impl::GenericGetUnchecked<Index>(std::move(variant));
+    }
+
+    template <typename T, typename... Ts>
+    constexpr T& GetUnchecked(Variant<Ts...>& variant) noexcept
+    {
+        static_assert(!std::is_void_v<T>);
+        return variantx::GetUnchecked<utilities::FindExactlyOne<T, Ts...>>(variant);
+    }
+
+    template <typename T, typename... Ts>
+    constexpr T&& GetUnchecked(Variant<Ts...>&& variant) noexcept
+    {
+        static_assert(!std::is_void_v<T>);
+        return variantx::GetUnchecked<utilities::FindExactlyOne<T, Ts...>>(std::move(variant));
+    }
+
+    template <typename T, typename... Ts>
+    constexpr const T& GetUnchecked(const Variant<Ts...>& variant) noexcept
+    {
+        static_assert(!std::is_void_v<T>);
+        return variantx::GetUnchecked<utilities::FindExactlyOne<T, Ts...>>(variant);
+    }
+
+    template <typename T, typename... Ts>
+    constexpr const T&& GetUnchecked(const Variant<Ts...>&& variant) noexcept
+    {
+        static_assert(!std::is_void_v<T>);
+        return variantx::GetUnchecked<utilities::FindExactlyOne<T, Ts...>>(std::move(variant));
+    }
+
     namespace impl
     {
         template <std::size_t Index, typename TVariant>
@@ -1386,7 +1826,8 @@ namespace variantx
 
             // specifically conditional operator
             return variant != nullptr && HoldsAlternative<Index>(*variant)
-                       ? std::addressof(Variant::GetAlternative<Index>(*variant).value_)
+                       ? std::addressof(
+                             access::Alternative::Value(Variant::GetAlternative<Index>(*variant)))
                        : nullptr;
         }
     }  // namespace impl
@@ -1425,32 +1866,100 @@ namespace variantx
         return variantx::GetIf<utilities::FindExactlyOne<T, Ts...>>(variant);
     }
 
-    template <std::size_t Index, typename... Ts>
-    struct VariantAlternative<Index, Variant<Ts...>>
+    namespace impl
     {
-        static_assert(Index < sizeof...(Ts), "Index out of variant range!");
-        using Type = utilities::GetTypeByIndex<Index, Ts...>;
-    };
+        template <std::size_t Index, typename TVariant>
+        constexpr auto GenericTryGet(TVariant& variant) noexcept
+        {
+            using impl::access::Variant;
+            using Value  = decltype(access::Alternative::Value(
+                Variant::GetAlternative<Index>(variant)));
+            using Result = AccessResult<std::remove_reference_t<Value>>;
 
-    template <std::size_t Index, typename... Ts>
-    struct VariantAlternative<Index, const Variant<Ts...>>
-    {
-        static_assert(Index < sizeof...(Ts), "Index out of variant range!");
-        using Type = std::add_const_t<utilities::GetTypeByIndex<Index, Ts...>>;
-    };
+            if (HoldsAlternative<Index>(variant)) [[likely]]
+            {
+                return Result(
+                    access::Alternative::Value(Variant::GetAlternative<Index>(variant)));
+            }
+
+            return Result(variant.ValuelessByException() ? AccessError::Valueless
+                                                          : AccessError::WrongAlternative);
+        }
+    }  // namespace impl
+
+    /*
+     * Never throws, costs the same as GetIf.
+     * Only lvalues are accepted, the result would dangle otherwise.
+     */
 
     template <std::size_t Index, typename... Ts>
-    struct VariantAlternative<Index, volatile Variant<Ts...>>
+    constexpr AccessResult<std::remove_reference_t<VariantAlternativeType<Index, Variant<Ts...>>>>
+    TryGet(Variant<Ts...>& variant) noexcept
     {
-        static_assert(false,
-                      "Deprecated since C++20 "
-                      "https://en.cppreference.com/w/cpp/utility/variant/variant_alternative.html");
-    };
+        static_assert(Index < sizeof...(Ts));
+        static_assert(!std::is_void_v<VariantAlternativeType<Index, Variant<Ts...>>>);
+
+        return impl::GenericTryGet<Index>(variant);
+    }
 
     template <std::size_t Index, typename... Ts>
-    struct VariantAlternative<Index, const volatile Variant<Ts...>>
+    constexpr AccessResult<
+        std::remove_reference_t<const VariantAlternativeType<Index, Variant<Ts...>>>>
+    TryGet(const Variant<Ts...>& variant) noexcept
     {
-        static_assert(false,
+        static_assert(Index < sizeof...(Ts));
+        static_assert(!std::is_void_v<VariantAlternativeType<Index, Variant<Ts...>>>);
+
+        return impl::GenericTryGet<Index>(variant);
+    }
+
+    template <std::size_t Index, typename... Ts>
+    void TryGet(const Variant<Ts...>&& variant) = delete;
+
+    template <typename T, typename... Ts>
+    constexpr AccessResult<std::remove_reference_t<T>> TryGet(Variant<Ts...>& variant) noexcept
+    {
+        static_assert(!std::is_void_v<T>);
+        return variantx::TryGet<utilities::FindExactlyOne<T, Ts...>>(variant);
+    }
+
+    template <typename T, typename... Ts>
+    constexpr AccessResult<std::remove_reference_t<const T>> TryGet(
+        const Variant<Ts...>& variant) noexcept
+    {
+        static_assert(!std::is_void_v<T>);
+        return variantx::TryGet<utilities::FindExactlyOne<T, Ts...>>(variant);
+    }
+
+    template <typename T, typename... Ts>
+    void TryGet(const Variant<Ts...>&& variant) = delete;
+
+    template <std::size_t Index, typename... Ts>
+    struct VariantAlternative<Index, Variant<Ts...>>
+    {
+        static_assert(Index < sizeof...(Ts), "Index out of variant range!");
+        using Type = utilities::GetTypeByIndex<Index, Ts...>;
+    };
+
+    template <std::size_t Index, typename... Ts>
+    struct VariantAlternative<Index, const Variant<Ts...>>
+    {
+        static_assert(Index < sizeof...(Ts), "Index out of variant range!");
+        using Type = std::add_const_t<utilities::GetTypeByIndex<Index, Ts...>>;
+    };
+
+    template <std::size_t Index, typename... Ts>
+    struct VariantAlternative<Index, volatile Variant<Ts...>>
+    {
+        static_assert(false,
+                      "Deprecated since C++20 "
+                      "https://en.cppreference.com/w/cpp/utility/variant/variant_alternative.html");
+    };
+
+    template <std::size_t Index, typename... Ts>
+    struct VariantAlternative<Index, const volatile Variant<Ts...>>
+    {
+        static_assert(false,
                       "Deprecated since C++20 "
                       "https://en.cppreference.com/w/cpp/utility/variant/variant_alternative.html");
     };
@@ -1465,187 +1974,374 @@ namespace variantx
             {
                 static_assert(
                     std::is_convertible_v<
-                        decltype(Operator()(std::forward<T>(fst), std::forward<U>(fst))), bool>);
+                        decltype(Operator()(std::forward<T>(fst), std::forward<U>(snd))), bool>);
 
                 return Operator()(std::forward<T>(fst), std::forward<U>(snd));
             }
         };
-    }  // namespace impl
 
-    template <typename... Ts>
-    constexpr bool operator==(const Variant<Ts...>& lhs, const Variant<Ts...>& rhs)
-    {
-        using impl::visitation::Variant;
-        if (lhs.Index() != rhs.Index())
+        // Order matters, used as an index in Holds()
+        enum class Relation : std::uint8_t
+        {
+            Equal        = 0,
+            NotEqual     = 1,
+            Less         = 2,
+            Greater      = 3,
+            LessEqual    = 4,
+            GreaterEqual = 5
+        };
+
+        template <typename Ordering>
+        constexpr bool Holds(Relation relation, Ordering ordering) noexcept
         {
+            switch (relation)
+            {
+                case Relation::Equal:
+                    return ordering == 0;
+                case Relation::NotEqual:
+                    return ordering != 0;
+                case Relation::Less:
+                    return ordering < 0;
+                case Relation::Greater:
+                    return ordering > 0;
+                case Relation::LessEqual:
+                    return ordering <= 0;
+                case Relation::GreaterEqual:
+                    return ordering >= 0;
+            }
+
             return false;
         }
-        if (lhs.ValuelessByException())
+
+        template <typename... Ts>
+        constexpr bool kThreeWayComparable = (std::three_way_comparable<Ts> && ...);
+
+        template <typename... Ts>
+        using ThreeWayResult =
+            std::common_comparison_category_t<std::compare_three_way_result_t<Ts>...>;
+
+        /*
+         * The visitor of operator<=>, and of every relational operator when all alternatives have
+         * <=>: each Variant type instantiates a single diagonal table for all of them, the
+         * operators only map the ordering (an unordered result is unequal and not less).
+         */
+        template <typename Result>
+        struct ThreeWay
         {
-            return true;
-        }
+            template <typename T>
+            constexpr Result operator()(const T& fst, const T& snd) const
+            {
+                return fst <=> snd;
+            }
+        };
 
-        return Variant::VisitValueAt(lhs.Index(), impl::Convert2Bool<std::equal_to<>>(), lhs, rhs);
-    }
+        template <Relation Kind>
+        struct Compare
+        {
+            /*
+             * Fallback for alternatives without <=>: one visitor per relation, so only the
+             * operator actually used is instantiated. Variant == Variant needs nothing but ==
+             * of the alternatives, as for std::variant.
+             */
+            template <typename T, typename U>
+            constexpr bool operator()(const T& fst, const U& snd) const
+            {
+                if constexpr (Kind == Relation::Equal)
+                {
+                    return Convert2Bool<std::equal_to<>>()(fst, snd);
+                }
+                else if constexpr (Kind == Relation::NotEqual)
+                {
+                    return Convert2Bool<std::not_equal_to<>>()(fst, snd);
+                }
+                else if constexpr (Kind == Relation::Less)
+                {
+                    return Convert2Bool<std::less<>>()(fst, snd);
+                }
+                else if constexpr (Kind == Relation::Greater)
+                {
+                    return Convert2Bool<std::greater<>>()(fst, snd);
+                }
+                else if constexpr (Kind == Relation::LessEqual)
+                {
+                    return Convert2Bool<std::less_equal<>>()(fst, snd);
+                }
+                else
+                {
+                    return Convert2Bool<std::greater_equal<>>()(fst, snd);
+                }
+            }
+        };
 
-    template <typename... Ts>
-    constexpr bool operator!=(const Variant<Ts...>& lhs, const Variant<Ts...>& rhs)
-    {
-        using impl::visitation::Variant;
-        if (lhs.Index() != rhs.Index())
+        template <typename... Ts>
+        constexpr std::strong_ordering CompareIndex(const Variant<Ts...>& lhs,
+                                                    const Variant<Ts...>& rhs) noexcept
         {
-            return true;
+            /*
+             * kVariantNpos + 1 wraps to 0, so valueless variant is less than any alternative
+             * and equal to another valueless variant.
+             */
+            return (lhs.Index() + 1) <=> (rhs.Index() + 1);
         }
-        if (lhs.ValuelessByException())
+
+        template <std::size_t Index, typename... Ts>
+        constexpr std::strong_ordering CompareIndex(const Variant<Ts...>& variant) noexcept
         {
-            return false;
+            // Ordering of the variant's index relative to the alternative `Index`.
+            return (variant.Index() + 1) <=> (Index + 1);
         }
 
-        return Variant::VisitValueAt(lhs.Index(), impl::Convert2Bool<std::not_equal_to<>>(), lhs,
-                                     rhs);
-    }
+        // Scalars only: a class may define == as anything but memberwise equality
+        template <typename... Ts>
+        constexpr bool kBitwiseEqualityComparable =
+            ((std::is_scalar_v<Ts> && std::has_unique_object_representations_v<Ts>) && ...);
 
-    template <typename... Ts>
-    constexpr bool operator<(const Variant<Ts...>& lhs, const Variant<Ts...>& rhs)
-    {
-        using impl::visitation::Variant;
-        if (rhs.ValuelessByException())
+        template <Relation Kind, typename... Ts>
+        constexpr bool CompareVariants(const Variant<Ts...>& lhs, const Variant<Ts...>& rhs)
         {
-            return false;
+            if (auto result = CompareIndex(lhs, rhs); result != 0 || lhs.ValuelessByException())
+            {
+                return Holds(Kind, result);
+            }
+
+            if constexpr (kBitwiseEqualityComparable<Ts...>)
+            {
+                /*
+                 * Integers, enums and pointers: equality is equality of the object
+                 * representation, no need to dispatch.
+                 */
+                if !consteval
+                {
+                    if constexpr (Kind == Relation::Equal || Kind == Relation::NotEqual)
+                    {
+                        // NOLINTNEXTLINE -> C-Style array
+                        constexpr std::size_t kSizes[] = {sizeof(Ts)...};
+
+                        const bool equal = std::memcmp(access::Variant::Storage(lhs),
+                                                       access::Variant::Storage(rhs),
+                                                       kSizes[lhs.Index()]) == 0;
+
+                        return equal == (Kind == Relation::Equal);
+                    }
+                }
+            }
+
+            if constexpr (kThreeWayComparable<Ts...>)
+            {
+                return Holds(Kind, visitation::Variant::VisitValueAt(
+                                       lhs.Index(), ThreeWay<ThreeWayResult<Ts...>>(), lhs, rhs));
+            }
+            else
+            {
+                return visitation::Variant::VisitValueAt(lhs.Index(), Compare<Kind>(), lhs, rhs);
+            }
         }
-        if (lhs.ValuelessByException())
+
+        template <std::size_t Index, typename TVariant>
+        constexpr const auto& UncheckedGet(const TVariant& variant) noexcept
         {
-            return true;
+            return access::Alternative::Value(access::Variant::GetAlternative<Index>(variant));
         }
-        if (lhs.Index() < rhs.Index())
+
+        template <typename T, typename... Ts>
+        concept ComparableAlternative =
+            requires { utilities::FindUnambiguousIndex<T, Ts...>::value; };
+
+        template <Relation Kind, typename T, typename... Ts>
+        constexpr bool CompareVariantValue(const Variant<Ts...>& lhs, const T& rhs)
         {
-            return true;
+            constexpr std::size_t kIndex = utilities::FindUnambiguousIndex<T, Ts...>::value;
+            if (auto result = CompareIndex<kIndex>(lhs); result != 0)
+            {
+                return Holds(Kind, result);
+            }
+
+            return Compare<Kind>()(UncheckedGet<kIndex>(lhs), rhs);
         }
-        if (lhs.Index() > rhs.Index())
+
+        template <Relation Kind, typename T, typename... Ts>
+        constexpr bool CompareValueVariant(const T& lhs, const Variant<Ts...>& rhs)
         {
-            return false;
+            constexpr std::size_t kIndex = utilities::FindUnambiguousIndex<T, Ts...>::value;
+            if (auto result = CompareIndex<kIndex>(rhs); result != 0)
+            {
+                return Holds(Kind, 0 <=> result);
+            }
+
+            return Compare<Kind>()(lhs, UncheckedGet<kIndex>(rhs));
         }
+    }  // namespace impl
 
-        return Variant::VisitValueAt(lhs.Index(), impl::Convert2Bool<std::less<>>(), lhs, rhs);
+    template <typename... Ts>
+    constexpr bool operator==(const Variant<Ts...>& lhs, const Variant<Ts...>& rhs)
+    {
+        return impl::CompareVariants<impl::Relation::Equal>(lhs, rhs);
     }
 
     template <typename... Ts>
-    constexpr bool operator>(const Variant<Ts...>& lhs, const Variant<Ts...>& rhs)
+    constexpr bool operator!=(const Variant<Ts...>& lhs, const Variant<Ts...>& rhs)
     {
-        using impl::visitation::Variant;
-        if (lhs.ValuelessByException())
-        {
-            return false;
-        }
-        if (rhs.ValuelessByException())
-        {
-            return true;
-        }
-        if (lhs.Index() > rhs.Index())
-        {
-            return true;
-        }
-        if (lhs.Index() < rhs.Index())
-        {
-            return false;
-        }
+        return impl::CompareVariants<impl::Relation::NotEqual>(lhs, rhs);
+    }
 
-        return Variant::VisitValueAt(lhs.Index(), impl::Convert2Bool<std::greater<>>(), lhs, rhs);
+    template <typename... Ts>
+    constexpr bool operator<(const Variant<Ts...>& lhs, const Variant<Ts...>& rhs)
+    {
+        return impl::CompareVariants<impl::Relation::Less>(lhs, rhs);
     }
 
     template <typename... Ts>
-    constexpr bool operator<=(const Variant<Ts...>& lhs, const Variant<Ts...>& rhs)
+    constexpr bool operator>(const Variant<Ts...>& lhs, const Variant<Ts...>& rhs)
     {
-        using impl::visitation::Variant;
-        if (lhs.ValuelessByException())
-        {
-            return true;
-        }
-        if (rhs.ValuelessByException())
-        {
-            return false;
-        }
-        if (lhs.Index() < rhs.Index())
-        {
-            return true;
-        }
-        if (lhs.Index() > rhs.Index())
-        {
-            return false;
-        }
+        return impl::CompareVariants<impl::Relation::Greater>(lhs, rhs);
+    }
 
-        return Variant::VisitValueAt(lhs.Index(), impl::Convert2Bool<std::less_equal<>>(), lhs,
-                                     rhs);
+    template <typename... Ts>
+    constexpr bool operator<=(const Variant<Ts...>& lhs, const Variant<Ts...>& rhs)
+    {
+        return impl::CompareVariants<impl::Relation::LessEqual>(lhs, rhs);
     }
 
     template <typename... Ts>
     constexpr bool operator>=(const Variant<Ts...>& lhs, const Variant<Ts...>& rhs)
     {
-        using impl::visitation::Variant;
-        if (rhs.ValuelessByException())
-        {
-            return true;
-        }
-        if (lhs.ValuelessByException())
-        {
-            return false;
-        }
-        if (lhs.Index() > rhs.Index())
-        {
-            return true;
-        }
-        if (lhs.Index() < rhs.Index())
+        return impl::CompareVariants<impl::Relation::GreaterEqual>(lhs, rhs);
+    }
+
+    template <typename... Ts>
+        requires(impl::kThreeWayComparable<Ts...>)
+    constexpr impl::ThreeWayResult<Ts...> operator<=>(const Variant<Ts...>& lhs,
+                                                      const Variant<Ts...>& rhs)
+    {
+        if (auto result = impl::CompareIndex(lhs, rhs); result != 0 || lhs.ValuelessByException())
         {
-            return false;
+            return result;
         }
 
-        return Variant::VisitValueAt(lhs.Index(), impl::Convert2Bool<std::greater_equal<>>(), lhs,
-                                     rhs);
+        return impl::visitation::Variant::VisitValueAt(
+            lhs.Index(), impl::ThreeWay<impl::ThreeWayResult<Ts...>>(), lhs, rhs);
     }
 
-    template <typename... Ts>
-        requires(std::three_way_comparable<Ts> && ...)
-    constexpr std::common_comparison_category_t<std::compare_three_way_result_t<Ts>...> operator<=>(
-        const Variant<Ts...>& lhs, const Variant<Ts...>& rhs)
+    /*
+     * Heterogeneous comparison with a value of one of the alternatives.
+     * Behaves like a comparison with Variant(std::in_place_type<T>, value), but without
+     * constructing a temporary variant and without a table dispatch.
+     */
+
+    template <typename T, typename... Ts>
+        requires impl::ComparableAlternative<T, Ts...>
+    constexpr bool operator==(const Variant<Ts...>& lhs, const T& rhs)
     {
-        using impl::visitation::Variant;
-        using ResultType =
-            std::common_comparison_category_t<std::compare_three_way_result_t<Ts>...>;
+        return impl::CompareVariantValue<impl::Relation::Equal>(lhs, rhs);
+    }
 
-        if (lhs.ValuelessByException() && rhs.ValuelessByException())
-        {
-            return std::strong_ordering::equal;
-        }
-        if (lhs.ValuelessByException())
-        {
-            return std::strong_ordering::less;
-        }
-        if (rhs.ValuelessByException())
-        {
-            return std::strong_ordering::greater;
-        }
-        if (auto result = lhs.Index() <=> rhs.Index(); result != 0)
+    template <typename T, typename... Ts>
+        requires impl::ComparableAlternative<T, Ts...>
+    constexpr bool operator==(const T& lhs, const Variant<Ts...>& rhs)
+    {
+        return impl::CompareValueVariant<impl::Relation::Equal>(lhs, rhs);
+    }
+
+    template <typename T, typename... Ts>
+        requires impl::ComparableAlternative<T, Ts...>
+    constexpr bool operator!=(const Variant<Ts...>& lhs, const T& rhs)
+    {
+        return impl::CompareVariantValue<impl::Relation::NotEqual>(lhs, rhs);
+    }
+
+    template <typename T, typename... Ts>
+        requires impl::ComparableAlternative<T, Ts...>
+    constexpr bool operator!=(const T& lhs, const Variant<Ts...>& rhs)
+    {
+        return impl::CompareValueVariant<impl::Relation::NotEqual>(lhs, rhs);
+    }
+
+    template <typename T, typename... Ts>
+        requires impl::ComparableAlternative<T, Ts...>
+    constexpr bool operator<(const Variant<Ts...>& lhs, const T& rhs)
+    {
+        return impl::CompareVariantValue<impl::Relation::Less>(lhs, rhs);
+    }
+
+    template <typename T, typename... Ts>
+        requires impl::ComparableAlternative<T, Ts...>
+    constexpr bool operator<(const T& lhs, const Variant<Ts...>& rhs)
+    {
+        return impl::CompareValueVariant<impl::Relation::Less>(lhs, rhs);
+    }
+
+    template <typename T, typename... Ts>
+        requires impl::ComparableAlternative<T, Ts...>
+    constexpr bool operator>(const Variant<Ts...>& lhs, const T& rhs)
+    {
+        return impl::CompareVariantValue<impl::Relation::Greater>(lhs, rhs);
+    }
+
+    template <typename T, typename... Ts>
+        requires impl::ComparableAlternative<T, Ts...>
+    constexpr bool operator>(const T& lhs, const Variant<Ts...>& rhs)
+    {
+        return impl::CompareValueVariant<impl::Relation::Greater>(lhs, rhs);
+    }
+
+    template <typename T, typename... Ts>
+        requires impl::ComparableAlternative<T, Ts...>
+    constexpr bool operator<=(const Variant<Ts...>& lhs, const T& rhs)
+    {
+        return impl::CompareVariantValue<impl::Relation::LessEqual>(lhs, rhs);
+    }
+
+    template <typename T, typename... Ts>
+        requires impl::ComparableAlternative<T, Ts...>
+    constexpr bool operator<=(const T& lhs, const Variant<Ts...>& rhs)
+    {
+        return impl::CompareValueVariant<impl::Relation::LessEqual>(lhs, rhs);
+    }
+
+    template <typename T, typename... Ts>
+        requires impl::ComparableAlternative<T, Ts...>
+    constexpr bool operator>=(const Variant<Ts...>& lhs, const T& rhs)
+    {
+        return impl::CompareVariantValue<impl::Relation::GreaterEqual>(lhs, rhs);
+    }
+
+    template <typename T, typename... Ts>
+        requires impl::ComparableAlternative<T, Ts...>
+    constexpr bool operator>=(const T& lhs, const Variant<Ts...>& rhs)
+    {
+        return impl::CompareValueVariant<impl::Relation::GreaterEqual>(lhs, rhs);
+    }
+
+    // Not constrained on std::three_way_comparable<T>: a more constrained operator<=> would be
+    // preferred over the relational operators above.
+    template <typename T, typename... Ts>
+        requires impl::ComparableAlternative<T, Ts...>
+    constexpr auto operator<=>(const Variant<Ts...>& lhs, const T& rhs)
+        -> std::compare_three_way_result_t<T>
+    {
+        constexpr std::size_t kIndex = utilities::FindUnambiguousIndex<T, Ts...>::value;
+        if (auto result = impl::CompareIndex<kIndex>(lhs); result != 0)
         {
             return result;
         }
 
-        auto three_way = []<typename T>(const T& fst, const T& snd) -> ResultType
-        { return fst <=> snd; };
-
-        return Variant::VisitValueAt(lhs.Index(), three_way, lhs, rhs);
+        return impl::UncheckedGet<kIndex>(lhs) <=> rhs;
     }
 
     namespace impl
     {
         template <typename... Variants>
         // NOLINTNEXTLINE
-        constexpr void ThrowIfValueless(Variants&&... variants)
+        constexpr void CheckNotValueless(Variants&&... variants)
         {
-            const bool valueless = (AsVariant(variants).ValuelessByException() || ...);
-            if (valueless)
-            {
-                throw variantx::BadVariantAccess();
-            }
+            impl::Check(!(AsVariant(variants).ValuelessByException() || ...));
+        }
+
+        template <typename... Variants>
+        // NOLINTNEXTLINE
+        constexpr void AssumeNotValueless(Variants&&... variants) noexcept
+        {
+            impl::Assume(!(AsVariant(variants).ValuelessByException() || ...));
         }
     }  // namespace impl
 
@@ -1654,7 +2350,7 @@ namespace variantx
     {
         using impl::visitation::Variant;
 
-        impl::ThrowIfValueless(std::forward<Variants>(variants)...);
+        impl::CheckNotValueless(std::forward<Variants>(variants)...);
         return Variant::VisitValue(std::forward<Visitor>(visitor),
                                    std::forward<Variants>(variants)...);
     }
@@ -1664,7 +2360,32 @@ namespace variantx
     {
         using impl::visitation::Variant;
 
-        impl::ThrowIfValueless(std::forward<Variants>(variants)...);
+        impl::CheckNotValueless(std::forward<Variants>(variants)...);
+        return Variant::VisitValue<Ret>(std::forward<Visitor>(visitor),
+                                        std::forward<Variants>(variants)...);
+    }
+
+    /*
+     * Precondition: none of the variants is valueless. Not checked in any VARIANTX_CHECKS mode.
+     */
+    template <typename Visitor, typename... Variants,
+              typename = std::void_t<decltype(impl::AsVariant(std::declval<Variants>()))...>>
+    constexpr decltype(auto) VisitUnchecked(Visitor&& visitor, Variants&&... variants)
+    {
+        using impl::visitation::Variant;
+
+        impl::AssumeNotValueless(std::forward<Variants>(variants)...);
+        return Variant::VisitValue(std::forward<Visitor>(visitor),
+                                   std::forward<Variants>(variants)...);
+    }
+
+    template <typename Ret, typename Visitor, typename... Variants,
+              typename = std::void_t<decltype(impl::AsVariant(std::declval<Variants>()))...>>
+    constexpr Ret VisitUnchecked(Visitor&& visitor, Variants&&... variants)
+    {
+        using impl::visitation::Variant;
+
+        impl::AssumeNotValueless(std::forward<Variants>(variants)...);
         return Variant::VisitValue<Ret>(std::forward<Visitor>(visitor),
                                         std::forward<Variants>(variants)...);
     }
@@ -1676,4 +2397,457 @@ namespace variantx
     {
         return lhs.swap(rhs);
     }
+
+    namespace impl
+    {
+        template <typename To, typename From>
+        struct VariantCastImpl;
+
+        template <typename... Us, typename... Ts>
+        struct VariantCastImpl<Variant<Us...>, Variant<Ts...>>
+        {
+            using To = Variant<Us...>;
+
+            // kRemap[i] is the index of Ts[i] in Us..., kVariantNpos if there is no such one
+            static constexpr std::array<std::size_t, sizeof...(Ts)> kRemap = {
+                utilities::detail::FindIndex<Ts, Us...>()...};
+
+            static constexpr bool kUnambiguous =
+                ((utilities::detail::FindIndex<Ts, Us...>() != utilities::detail::kAmbiguous) &&
+                 ...);
+
+            static constexpr bool kWidening =
+                ((utilities::detail::FindIndex<Ts, Us...>() != kVariantNpos) && ...);
+
+            using Result = std::conditional_t<kWidening, To, std::expected<To, AccessError>>;
+
+            template <typename TVariant>
+            static constexpr bool kConstructible = []<std::size_t... Indices>(
+                                                       std::index_sequence<Indices...>)
+            {
+                return ((kRemap[Indices] == kVariantNpos ||
+                         std::is_constructible_v<
+                             To, std::in_place_index_t<kRemap[Indices]>,
+                             decltype(GetUnchecked<Indices>(std::declval<TVariant>()))>) &&
+                        ...);
+            }(std::index_sequence_for<Ts...>());
+
+            template <std::size_t Index, typename TVariant>
+            static constexpr Result Construct(TVariant&& from)
+            {
+                if constexpr (kRemap[Index] == kVariantNpos)
+                {
+                    return std::unexpected(AccessError::WrongAlternative);
+                }
+                else
+                {
+                    return To(std::in_place_index<kRemap[Index]>,
+                              GetUnchecked<Index>(std::forward<TVariant>(from)));
+                }
+            }
+
+            // One entry per alternative of the source, no SelectorType resolution at run time
+            template <typename TVariant>
+            static constexpr auto kTable = []<std::size_t... Indices>(
+                                               std::index_sequence<Indices...>)
+            {
+                return std::array<Result (*)(TVariant&&), sizeof...(Ts)>{
+                    &Construct<Indices, TVariant>...};
+            }(std::index_sequence_for<Ts...>());
+
+            template <typename TVariant>
+            static constexpr Result Cast(TVariant&& from)
+            {
+                if constexpr (kWidening)
+                {
+                    CheckNotValueless(from);
+                }
+                else if (from.ValuelessByException())
+                {
+                    return std::unexpected(AccessError::Valueless);
+                }
+
+                return kTable<TVariant>[from.Index()](std::forward<TVariant>(from));
+            }
+        };
+
+        template <typename To, typename From>
+        concept VariantCastable = requires {
+            requires VariantCastImpl<To, std::remove_cvref_t<From>>::kUnambiguous;
+            requires VariantCastImpl<To, std::remove_cvref_t<From>>::template kConstructible<From>;
+        };
+    }  // namespace impl
+
+    /*
+     * Converts between variants whose alternatives are subsets of one another, every alternative
+     * is matched by its exact type and constructed directly at its index in `To`.
+     *
+     * Widening (every alternative of `from` is in `To`) returns `To`, a valueless `from` is
+     * checked as Visit does. Narrowing returns std::expected<To, AccessError>, the error is
+     * WrongAlternative if `To` has no alternative `from` holds, Valueless if `from` is valueless.
+     */
+    template <typename To, typename... Ts>
+        requires impl::VariantCastable<To, const Variant<Ts...>&>
+    constexpr auto VariantCast(const Variant<Ts...>& from)
+    {
+        return impl::VariantCastImpl<To, Variant<Ts...>>::Cast(from);
+    }
+
+    template <typename To, typename... Ts>
+        requires impl::VariantCastable<To, Variant<Ts...>&&>
+    constexpr auto VariantCast(Variant<Ts...>&& from)
+    {
+        return impl::VariantCastImpl<To, Variant<Ts...>>::Cast(std::move(from));
+    }
+
+    namespace impl
+    {
+        template <typename... Ts>
+        struct TypeList
+        {
+        };
+
+        /*
+         * Depth first over the alternatives, nested Variant<...> alternatives are replaced by
+         * their own alternatives, the first occurrence of every type is kept.
+         */
+        template <typename Flattened, typename... Ts>
+        struct FlattenImpl;
+
+        template <typename... Flattened>
+        struct FlattenImpl<TypeList<Flattened...>>
+        {
+            using Type = Variant<Flattened...>;
+        };
+
+        template <typename... Flattened, typename... Nested, typename... Rest>
+        struct FlattenImpl<TypeList<Flattened...>, Variant<Nested...>, Rest...>
+            : FlattenImpl<TypeList<Flattened...>, Nested..., Rest...>
+        {
+        };
+
+        template <typename... Flattened, typename T, typename... Rest>
+        struct FlattenImpl<TypeList<Flattened...>, T, Rest...>
+            : std::conditional_t<(std::is_same_v<T, Flattened> || ...),
+                                 FlattenImpl<TypeList<Flattened...>, Rest...>,
+                                 FlattenImpl<TypeList<Flattened..., T>, Rest...>>
+        {
+        };
+    }  // namespace impl
+
+    template <typename... Ts>
+    struct FlattenVariant<Variant<Ts...>>
+    {
+        using Type = typename impl::FlattenImpl<impl::TypeList<>, Ts...>::Type;
+    };
+
+    namespace impl
+    {
+        template <typename T>
+        constexpr bool kIsVariant = false;
+
+        template <typename... Ts>
+        constexpr bool kIsVariant<Variant<Ts...>> = true;
+
+        template <typename Flat, typename From>
+        struct FlattenCastImpl;
+
+        template <typename... Us, typename... Ts>
+        struct FlattenCastImpl<Variant<Us...>, Variant<Ts...>>
+        {
+            using To = Variant<Us...>;
+
+            template <std::size_t Index, typename TVariant>
+            static constexpr To Construct(TVariant&& from)
+            {
+                using T = utilities::GetTypeByIndex<Index, Ts...>;
+
+                if constexpr (kIsVariant<T>)
+                {
+                    return FlattenCastImpl<To, T>::Cast(
+                        GetUnchecked<Index>(std::forward<TVariant>(from)));
+                }
+                else
+                {
+                    // Alternatives of To are unique, so the index is just the position of T
+                    constexpr std::size_t kIndex = utilities::FindExactlyOne<T, Us...>;
+
+                    return To(std::in_place_index<kIndex>,
+                              GetUnchecked<Index>(std::forward<TVariant>(from)));
+                }
+            }
+
+            template <typename TVariant>
+            static constexpr auto kTable = []<std::size_t... Indices>(
+                                               std::index_sequence<Indices...>)
+            {
+                return std::array<To (*)(TVariant&&), sizeof...(Ts)>{
+                    &Construct<Indices, TVariant>...};
+            }(std::index_sequence_for<Ts...>());
+
+            template <typename TVariant>
+            static constexpr To Cast(TVariant&& from)
+            {
+                CheckNotValueless(from);
+                return kTable<TVariant>[from.Index()](std::forward<TVariant>(from));
+            }
+        };
+    }  // namespace impl
+
+    /*
+     * Variant<Variant<A, B>, C, A> -> Variant<A, B, C>: one discriminator and one dispatch per
+     * Visit instead of one per level. Every level of `from` is dispatched once through a table
+     * with precomputed indices of FlattenVariantType. A valueless variant at any level is
+     * checked as Visit does.
+     */
+    template <typename... Ts>
+    constexpr FlattenVariantType<Variant<Ts...>> Flatten(const Variant<Ts...>& from)
+    {
+        return impl::FlattenCastImpl<FlattenVariantType<Variant<Ts...>>, Variant<Ts...>>::Cast(
+            from);
+    }
+
+    template <typename... Ts>
+    constexpr FlattenVariantType<Variant<Ts...>> Flatten(Variant<Ts...>&& from)
+    {
+        return impl::FlattenCastImpl<FlattenVariantType<Variant<Ts...>>, Variant<Ts...>>::Cast(
+            std::move(from));
+    }
+
+    /*
+     * Non-owning view of an alternative: a pointer and an index, no copies.
+     * Binds to a T& of any alternative or to a whole Variant<Ts...>&, ConstVariantRef also to
+     * const ones. It is a Variant<Ts&...>, so Visit, Get<Index> and comparisons work as usual,
+     * by type the alternatives are Get<T&>. Assignment rebinds the view.
+     */
+    template <typename... Ts>
+    class VariantRef : public Variant<Ts&...>
+    {
+        using BaseType = Variant<Ts&...>;
+
+        template <typename TVariant>
+        static constexpr BaseType Bind(TVariant& variant)
+        {
+            impl::CheckNotValueless(variant);
+
+            constexpr auto kTable = []<std::size_t... Indices>(std::index_sequence<Indices...>)
+            {
+                return std::array<BaseType (*)(TVariant&), sizeof...(Ts)>{
+                    [](TVariant& from) -> BaseType {
+                        return BaseType(std::in_place_index<Indices>, GetUnchecked<Indices>(from));
+                    }...};
+            }(std::index_sequence_for<Ts...>());
+
+            return kTable[variant.Index()](variant);
+        }
+
+    public:
+        using BaseType::BaseType;
+
+        // clang-format off
+        template <typename... Us>
+            requires (
+                sizeof...(Us) == sizeof...(Ts) &&
+                (std::is_same_v<std::remove_const_t<Ts>, Us> && ...)
+            )
+        constexpr VariantRef(Variant<Us...>& variant)  // NOLINT -> non-explicit
+            : BaseType(Bind(variant))
+        {
+        }
+        // clang-format on
+
+        // clang-format off
+        template <typename... Us>
+            requires (
+                sizeof...(Us) == sizeof...(Ts) &&
+                (std::is_same_v<Ts, const Us> && ...)
+            )
+        constexpr VariantRef(const Variant<Us...>& variant)  // NOLINT -> non-explicit
+            : BaseType(Bind(variant))
+        {
+        }
+        // clang-format on
+
+        // Views of rvalues would dangle
+        template <typename... Us>
+        VariantRef(const Variant<Us...>&&) = delete;
+    };
+
+    template <typename... Ts>
+    VariantRef(Variant<Ts...>&) -> VariantRef<Ts...>;
+
+    template <typename... Ts>
+    VariantRef(const Variant<Ts...>&) -> VariantRef<const Ts...>;
+
+    template <typename... Ts>
+    using ConstVariantRef = VariantRef<const Ts...>;
+
+    namespace impl
+    {
+        template <typename T>
+        constexpr bool kHashable =
+            std::is_default_constructible_v<std::hash<std::remove_cvref_t<T>>>;
+
+        // Integers only: std::hash of an enum or a pointer may be specialized by the user
+        template <typename... Ts>
+        constexpr bool kBitwiseHashable =
+            kBitwiseEqualityComparable<Ts...> && (std::is_integral_v<Ts> && ...);
+
+        constexpr std::size_t MixHash(std::size_t index, std::uint64_t hash) noexcept
+        {
+            // murmur3 fmix64 over the alternative's hash salted with the index
+            std::uint64_t result = hash ^ (index * 0x9E3779B97F4A7C15ULL);
+
+            result ^= result >> 33U;
+            result *= 0xFF51AFD7ED558CCDULL;
+            result ^= result >> 33U;
+            result *= 0xC4CEB9FE1A85EC53ULL;
+            result ^= result >> 33U;
+
+            return static_cast<std::size_t>(result);
+        }
+
+        inline std::uint64_t HashBytes(const void* data, std::size_t size) noexcept
+        {
+            const auto*   bytes  = static_cast<const unsigned char*>(data);
+            std::uint64_t result = 0xCBF29CE484222325ULL ^ size;
+
+            // word at a time, the tail is zero padded
+            for (; size >= sizeof(std::uint64_t); size -= sizeof(std::uint64_t))
+            {
+                std::uint64_t word = 0;
+                std::memcpy(&word, bytes, sizeof(word));
+
+                result = (result ^ word) * 0x100000001B3ULL;
+                bytes += sizeof(word);  // NOLINT -> pointer arithmetic
+            }
+
+            if (size != 0)
+            {
+                std::uint64_t word = 0;
+                std::memcpy(&word, bytes, size);
+
+                result = (result ^ word) * 0x100000001B3ULL;
+            }
+
+            return result;
+        }
+
+        // Decided per alternative: the integers of a mixed variant are still hashed as bytes
+        struct HashAlternative
+        {
+            template <typename T>
+            std::uint64_t operator()(const T& value) const
+            {
+                if constexpr (kBitwiseHashable<T>)
+                {
+                    return HashBytes(std::addressof(value), sizeof(T));
+                }
+                else
+                {
+                    return std::hash<std::remove_const_t<T>>()(value);
+                }
+            }
+        };
+
+        template <typename... Ts>
+        std::size_t HashVariant(const Variant<Ts...>& variant)
+        {
+            if (variant.ValuelessByException())
+            {
+                return MixHash(kVariantNpos, 0);
+            }
+
+            if constexpr (kBitwiseHashable<Ts...>)
+            {
+                /*
+                 * Equal integers have equal bytes (see CompareVariants), so the bytes of the
+                 * active alternative can be hashed directly, no dispatch needed.
+                 */
+
+                // NOLINTNEXTLINE -> C-Style array
+                constexpr std::size_t kSizes[] = {sizeof(Ts)...};
+
+                return MixHash(variant.Index(), HashBytes(access::Variant::Storage(variant),
+                                                          kSizes[variant.Index()]));
+            }
+            else
+            {
+                return MixHash(variant.Index(),
+                               visitation::Variant::VisitValueAt(variant.Index(),
+                                                                 HashAlternative(), variant));
+            }
+        }
+
+        // One pass for the alternative `Index`, the first pass also takes the valueless elements
+        template <std::size_t Index, typename... Ts>
+        void HashGroup(std::span<const Variant<Ts...>> variants, std::span<std::size_t> hashes)
+        {
+            // Monomorphic loop, no dispatch
+            const HashAlternative hasher;
+            for (std::size_t i = 0; i < variants.size(); ++i)
+            {
+                const std::size_t index = variants[i].Index();
+                if (index == Index)
+                {
+                    hashes[i] = MixHash(Index, hasher(UncheckedGet<Index>(variants[i])));
+                }
+
+                if constexpr (Index == 0)
+                {
+                    if (index == kVariantNpos)
+                    {
+                        hashes[i] = MixHash(kVariantNpos, 0);
+                    }
+                }
+            }
+        }
+    }  // namespace impl
+
+    /*
+     * Batch version of std::hash<Variant<Ts...>>, hashes[i] == hash(variants[i]).
+     * Every alternative is hashed in its own pass over the indices, so there is no indirect
+     * call per element and nothing is allocated.
+     *
+     * Precondition: hashes.size() >= variants.size().
+     */
+    template <typename... Ts>
+        requires(impl::kHashable<Ts> && ...)
+    void HashAll(std::span<const Variant<Ts...>> variants, std::span<std::size_t> hashes)
+    {
+        if constexpr (impl::kBitwiseHashable<Ts...>)
+        {
+            // Already dispatch free
+            for (std::size_t i = 0; i < variants.size(); ++i)
+            {
+                hashes[i] = impl::HashVariant(variants[i]);
+            }
+        }
+        else
+        {
+            [&]<std::size_t... Indices>(std::index_sequence<Indices...>)
+            {
+                (impl::HashGroup<Indices>(variants, hashes), ...);
+            }(std::index_sequence_for<Ts...>());
+        }
+    }
 }  // namespace variantx
+
+template <typename... Ts>
+    requires(variantx::impl::kHashable<Ts> && ...)
+struct std::hash<variantx::Variant<Ts...>>
+{
+    std::size_t operator()(const variantx::Variant<Ts...>& variant) const
+    {
+        return variantx::impl::HashVariant(variant);
+    }
+};
+
+template <>
+struct std::hash<variantx::Monostate>
+{
+    std::size_t operator()(variantx::Monostate) const noexcept
+    {
+        return static_cast<std::size_t>(0x2545F4914F6CDD1DULL);
+    }
+};
@@ -1,11 +1,19 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <compare>
+#include <cstdint>
 #include <exception>
+#include <expected>
+#include <functional>
 #include <headers/variantx.hpp>
+#include <limits>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -17,6 +25,12 @@
 #define EXPECT_TRUE(...) GTEST_EXPECT_TRUE((__VA_ARGS__))
 #define EXPECT_FALSE(...) GTEST_EXPECT_FALSE((__VA_ARGS__))
 
+template <>
+struct variantx::ReuseStorage<advanced_test::ReusableBuffer>
+{
+    static constexpr bool kValue = true;
+};
+
 // NOLINTBEGIN
 namespace advanced_test
 {
@@ -562,6 +576,107 @@ namespace advanced_test
         ASSERT_EQ(Get<0>(v), t);
     }
 
+    TEST(correctness, emplace_with)
+    {
+        struct Immovable
+        {
+            explicit Immovable(int value) : value(value) {}
+
+            Immovable(const Immovable&)            = delete;
+            Immovable(Immovable&&)                 = delete;
+            Immovable& operator=(const Immovable&) = delete;
+            Immovable& operator=(Immovable&&)      = delete;
+
+            int value;
+        };
+
+        variantx::Variant<int, Immovable> v;
+
+        Immovable& ref = v.EmplaceWith<1>([] { return Immovable(42); });
+        EXPECT_EQ(v.Index(), 1);
+        EXPECT_EQ(ref.value, 42);
+        EXPECT_EQ(&ref, &variantx::Get<1>(v));
+
+        v.EmplaceWith<int>([] { return 7; });
+        EXPECT_EQ(variantx::Get<int>(v), 7);
+
+        v.EmplaceWith<Immovable>([] { return Immovable(8); });
+        EXPECT_EQ(variantx::Get<Immovable>(v).value, 8);
+    }
+
+    TEST(correctness, emplace_with_no_moves)
+    {
+        using M = ThrowingMembers<ThrowingMemberParams{}>;
+        M::reset_counters();
+
+        variantx::Variant<int, M> v;
+        v.EmplaceWith<M>([] { return M(ThrowingMembersConstructorTag{}); });
+
+        EXPECT_EQ(v.Index(), 1);
+        EXPECT_EQ(M::copy_calls(), 0);
+        EXPECT_EQ(M::move_calls(), 0);
+
+        v.Emplace<M>(M(ThrowingMembersConstructorTag{}));
+        EXPECT_EQ(M::move_calls(), 1);
+    }
+
+    TEST(correctness, emplace_with_throwing_factory)
+    {
+        variantx::Variant<int, std::string> v(std::string("abc"));
+
+        EXPECT_ANY_THROW(v.EmplaceWith<1>([]() -> std::string { throw std::exception(); }));
+        EXPECT_TRUE(v.ValuelessByException());
+
+        v.EmplaceWith<0>([] { return 1; });
+        EXPECT_EQ(variantx::Get<0>(v), 1);
+    }
+
+    TEST(correctness, emplace_reuses_storage)
+    {
+        variantx::Variant<int, ReusableBuffer> v(std::in_place_index<1>, std::size_t{100});
+
+        const int* data = variantx::Get<1>(v).data.data();
+
+        ReusableBuffer& ref = v.Emplace<1>(std::size_t{10});
+        EXPECT_EQ(&ref, &variantx::Get<1>(v));
+        EXPECT_EQ(ref.data.size(), 10);
+        EXPECT_GE(ref.data.capacity(), 100);
+        EXPECT_EQ(ref.data.data(), data);
+
+        v.Reset<ReusableBuffer>();
+        EXPECT_TRUE(variantx::Get<1>(v).data.empty());
+        EXPECT_GE(variantx::Get<1>(v).data.capacity(), 100);
+
+        v.Reset<0>();
+        EXPECT_EQ(variantx::Get<0>(v), 0);
+
+        v.Emplace<1>(std::size_t{3});
+        EXPECT_EQ(variantx::Get<1>(v).data, std::vector<int>(3));
+    }
+
+    TEST(correctness, emplace_or_assign)
+    {
+        variantx::Variant<int, std::string> v(std::string(64, 'a'));
+
+        const auto capacity = variantx::Get<1>(v).capacity();
+
+        std::string& ref = v.EmplaceOrAssign<std::string>("abc");
+        EXPECT_EQ(ref, "abc");
+        EXPECT_EQ(ref.capacity(), capacity);
+
+        v.EmplaceOrAssign<0>(5);
+        EXPECT_EQ(variantx::Get<0>(v), 5);
+
+        v.EmplaceOrAssign<int>(6);
+        EXPECT_EQ(variantx::Get<0>(v), 6);
+
+        // No ReuseStorage: opt-in only, Emplace and Reset still reconstruct
+        static_assert(!variantx::ReuseStorage<std::string>::kValue);
+        static_assert(!variantx::ReuseStorage<std::vector<int>>::kValue);
+        v.EmplaceOrAssign<1>("def");
+        EXPECT_TRUE(v.Reset<std::string>().empty());
+    }
+
     TEST(correctness, emplace_conversions)
     {
         using V = variantx::Variant<int, std::string>;
@@ -670,6 +785,98 @@ namespace advanced_test
         ASSERT_THROW(Get<1>(v), variantx::BadVariantAccess);
     }
 
+    TEST(correctness, TryGet)
+    {
+        using V = variantx::Variant<int, std::string, EmptyComparable>;
+
+        static_assert(noexcept(variantx::TryGet<0>(std::declval<V&>())));
+        static_assert(std::is_same_v<decltype(variantx::TryGet<std::string>(std::declval<V&>())),
+                                     variantx::AccessResult<std::string>>);
+        static_assert(
+            std::is_same_v<decltype(variantx::TryGet<1>(std::declval<const V&>())),
+                           variantx::AccessResult<const std::string>>);
+        static_assert(std::is_trivially_copyable_v<variantx::AccessResult<std::string>>);
+
+        V v(std::string("abc"));
+
+        auto str = variantx::TryGet<std::string>(v);
+        ASSERT_TRUE(str.HasValue());
+        EXPECT_EQ(*str, "abc");
+        EXPECT_EQ(str->size(), 3);
+        EXPECT_EQ(&str.Value(), &variantx::Get<1>(v));
+
+        str.Value() = "def";
+        EXPECT_EQ(variantx::Get<1>(v), "def");
+
+        auto num = variantx::TryGet<0>(v);
+        ASSERT_FALSE(num);
+        EXPECT_EQ(num.Error(), variantx::AccessError::WrongAlternative);
+        EXPECT_EQ(num.ValueOr(7), 7);
+        EXPECT_THROW(num.Value(), variantx::BadVariantAccess);
+
+        const V& cv                                  = v;
+        variantx::AccessResult<const std::string> cs = variantx::TryGet<1>(cv);
+        EXPECT_EQ(*cs, "def");
+
+        ASSERT_ANY_THROW(v = V(std::in_place_index<2>));
+        ASSERT_TRUE(v.ValuelessByException());
+        EXPECT_EQ(variantx::TryGet<1>(v).Error(), variantx::AccessError::Valueless);
+    }
+
+    TEST(correctness, TryGet_monadic)
+    {
+        using V = variantx::Variant<int, std::string>;
+
+        V number(42);
+        V text(std::string("abc"));
+
+        // std::expected for values
+        auto doubled = variantx::TryGet<int>(number).Transform([](int x) { return x * 2; });
+        static_assert(std::is_same_v<decltype(doubled), std::expected<int, variantx::AccessError>>);
+        ASSERT_TRUE(doubled.has_value());
+        EXPECT_EQ(*doubled, 84);
+
+        auto missing = variantx::TryGet<int>(text).Transform([](int x) { return x * 2; });
+        ASSERT_FALSE(missing.has_value());
+        EXPECT_EQ(missing.error(), variantx::AccessError::WrongAlternative);
+
+        // AccessResult for references
+        struct Pair
+        {
+            int fst;
+            int snd;
+        };
+
+        variantx::Variant<Pair, int> pair(Pair{1, 2});
+        auto snd = variantx::TryGet<Pair>(pair).Transform([](Pair& p) -> int& { return p.snd; });
+        static_assert(std::is_same_v<decltype(snd), variantx::AccessResult<int>>);
+        ASSERT_TRUE(snd);
+        *snd = 5;
+        EXPECT_EQ(variantx::Get<Pair>(pair).snd, 5);
+
+        const auto and_then = [&text](int) { return variantx::TryGet<std::string>(text); };
+        EXPECT_EQ(*variantx::TryGet<int>(number).AndThen(and_then), "abc");
+        EXPECT_EQ(variantx::TryGet<int>(text).AndThen(and_then).Error(),
+                  variantx::AccessError::WrongAlternative);
+
+        const auto and_then_expected = [](int x) -> std::expected<int, variantx::AccessError>
+        { return x + 1; };
+        EXPECT_EQ(*variantx::TryGet<int>(number).AndThen(and_then_expected), 43);
+        EXPECT_EQ(variantx::TryGet<int>(text).AndThen(and_then_expected).error(),
+                  variantx::AccessError::WrongAlternative);
+
+        const auto or_else = [&number](variantx::AccessError)
+        { return variantx::TryGet<int>(number); };
+        EXPECT_EQ(*variantx::TryGet<int>(text).OrElse(or_else), 42);
+    }
+
+    static_assert(
+        []
+        {
+            variantx::Variant<int, double> v(2.0);
+            return !variantx::TryGet<int>(v) && variantx::TryGet<double>(v).ValueOr(0.0) == 2.0;
+        }());
+
     TEST(correctness, overloaded_address)
     {
         using V = variantx::Variant<int, OverloadedAddressOf, std::string>;
@@ -1493,21 +1700,22 @@ namespace advanced_test
         EXPECT_TRUE(operator>=(b, a));
         EXPECT_EQ(operator<=>(b, a), std::strong_ordering::greater);
 
-        EXPECT_EQ(ca.equal, 2);
-        EXPECT_EQ(ca.not_equal, 2);
-        EXPECT_EQ(ca.less, 2);
-        EXPECT_EQ(ca.less_equal, 2);
-        EXPECT_EQ(ca.greater, 2);
-        EXPECT_EQ(ca.greater_equal, 2);
-        EXPECT_EQ(ca.spaceship, 2);
+        // The alternative has <=>: every operator goes through the one three-way kernel
+        EXPECT_EQ(ca.equal, 0);
+        EXPECT_EQ(ca.not_equal, 0);
+        EXPECT_EQ(ca.less, 0);
+        EXPECT_EQ(ca.less_equal, 0);
+        EXPECT_EQ(ca.greater, 0);
+        EXPECT_EQ(ca.greater_equal, 0);
+        EXPECT_EQ(ca.spaceship, 14);
 
-        EXPECT_EQ(cb.equal, 1);
-        EXPECT_EQ(cb.not_equal, 1);
-        EXPECT_EQ(cb.less, 1);
-        EXPECT_EQ(cb.less_equal, 1);
-        EXPECT_EQ(cb.greater, 1);
-        EXPECT_EQ(cb.greater_equal, 1);
-        EXPECT_EQ(cb.spaceship, 1);
+        EXPECT_EQ(cb.equal, 0);
+        EXPECT_EQ(cb.not_equal, 0);
+        EXPECT_EQ(cb.less, 0);
+        EXPECT_EQ(cb.less_equal, 0);
+        EXPECT_EQ(cb.greater, 0);
+        EXPECT_EQ(cb.greater_equal, 0);
+        EXPECT_EQ(cb.spaceship, 7);
     }
 
     TEST(relops, three_way_category)
@@ -1549,6 +1757,920 @@ namespace advanced_test
         }
     }
 
+    TEST(relops, bitwise_comparable)
+    {
+        enum class Color : std::uint8_t
+        {
+            Red,
+            Green
+        };
+
+        using V = variantx::Variant<int, unsigned long long, Color, const char*>;
+
+        const char* str = "str";
+
+        EXPECT_TRUE(V(1) == V(1));
+        EXPECT_FALSE(V(1) == V(2));
+        EXPECT_TRUE(V(1) != V(1ULL));
+        EXPECT_TRUE(V(Color::Green) == V(Color::Green));
+        EXPECT_TRUE(V(Color::Green) != V(Color::Red));
+        EXPECT_TRUE(V(str) == V(str));
+
+        std::vector<V> values = {V(Color::Green), V(3ULL), V(-1), V(Color::Red), V(7), V(1ULL)};
+        std::ranges::sort(values, std::less<>());
+
+        const std::vector<V> expected = {V(-1),   V(7),           V(1ULL),
+                                         V(3ULL), V(Color::Red), V(Color::Green)};
+        EXPECT_TRUE(values == expected);
+    }
+
+    TEST(relops, only_used_operator)
+    {
+        struct OnlyEqual
+        {
+            int value;
+
+            bool operator==(const OnlyEqual&) const = default;
+        };
+
+        struct OnlyLess
+        {
+            int value;
+
+            bool operator<(const OnlyLess& that) const { return value < that.value; }
+        };
+
+        using Equal = variantx::Variant<int, OnlyEqual>;
+        EXPECT_TRUE(Equal(OnlyEqual{1}) == Equal(OnlyEqual{1}));
+        EXPECT_TRUE(Equal(OnlyEqual{1}) != Equal(OnlyEqual{2}));
+        EXPECT_TRUE(Equal(OnlyEqual{1}) == OnlyEqual{1});
+
+        using Less = variantx::Variant<int, OnlyLess>;
+        EXPECT_TRUE(Less(OnlyLess{1}) < Less(OnlyLess{2}));
+        EXPECT_FALSE(Less(OnlyLess{2}) < OnlyLess{1});
+        EXPECT_TRUE(Less(1) < Less(OnlyLess{0}));
+    }
+
+    TEST(relops, three_way_kernel_unordered)
+    {
+        // partial_ordering::unordered: unequal, and neither less nor greater
+        using V = variantx::Variant<int, double>;
+
+        const V nan(std::numeric_limits<double>::quiet_NaN());
+        EXPECT_FALSE(nan == nan);
+        EXPECT_TRUE(nan != nan);
+        EXPECT_FALSE(nan < nan);
+        EXPECT_FALSE(nan <= nan);
+        EXPECT_FALSE(nan > nan);
+        EXPECT_FALSE(nan >= nan);
+        EXPECT_EQ(nan <=> nan, std::partial_ordering::unordered);
+
+        EXPECT_TRUE(V(1.0) < V(2.0));
+        EXPECT_TRUE(V(1) < V(1.0));
+    }
+
+    TEST(relops, custom_equality_not_bitwise)
+    {
+        // Trivially copyable without padding, but equal by key only
+        struct Keyed
+        {
+            int key;
+            int payload;
+
+            bool operator==(const Keyed& that) const { return key == that.key; }
+        };
+
+        static_assert(std::has_unique_object_representations_v<Keyed>);
+
+        using V = variantx::Variant<int, Keyed>;
+        EXPECT_TRUE(V(Keyed{1, 2}) == V(Keyed{1, 3}));
+        EXPECT_FALSE(V(Keyed{1, 2}) != V(Keyed{1, 3}));
+        EXPECT_TRUE(V(Keyed{1, 2}) != V(Keyed{2, 2}));
+    }
+
+    TEST(relops, heterogeneous)
+    {
+        using V = variantx::Variant<int, std::string>;
+
+        V v1(42);
+        V v2(std::string("abc"));
+
+        EXPECT_TRUE(v1 == 42);
+        EXPECT_TRUE(42 == v1);
+        EXPECT_FALSE(v1 != 42);
+        EXPECT_TRUE(v1 != 43);
+        EXPECT_TRUE(v2 == std::string("abc"));
+        EXPECT_FALSE(v2 == 42);
+        EXPECT_TRUE(v2 != 42);
+
+        // Ordering is the same as for Variant(std::in_place_type<T>, value)
+        EXPECT_TRUE(v1 < 43);
+        EXPECT_TRUE(41 < v1);
+        EXPECT_TRUE(v1 <= 42);
+        EXPECT_TRUE(v1 >= 42);
+        EXPECT_TRUE(v2 > 100);
+        EXPECT_TRUE(100 < v2);
+        EXPECT_TRUE(v1 < std::string("a"));
+        EXPECT_TRUE(std::string("a") > v1);
+        EXPECT_FALSE(v2 <= 100);
+        EXPECT_FALSE(100 >= v2);
+
+        EXPECT_EQ(v1 <=> 42, std::strong_ordering::equal);
+        EXPECT_EQ(v1 <=> 50, std::strong_ordering::less);
+        EXPECT_EQ(50 <=> v1, std::strong_ordering::greater);
+        EXPECT_EQ(v2 <=> 0, std::strong_ordering::greater);
+    }
+
+    TEST(relops, heterogeneous_valueless)
+    {
+        using V = variantx::Variant<int, EmptyComparable, std::string>;
+
+        V v;
+        ASSERT_ANY_THROW(v = V(std::in_place_type<EmptyComparable>));
+        ASSERT_TRUE(v.ValuelessByException());
+
+        EXPECT_FALSE(v == 0);
+        EXPECT_TRUE(v != 0);
+        EXPECT_TRUE(v < 0);
+        EXPECT_TRUE(0 > v);
+        EXPECT_FALSE(v >= 0);
+        EXPECT_FALSE(0 <= v);
+    }
+
+    TEST(relops, heterogeneous_custom)
+    {
+        ComparisonCounters                       counters;
+        CustomComparable                         value(42, &counters);
+        variantx::Variant<int, CustomComparable> v(std::in_place_index<1>, 42, &counters);
+
+        EXPECT_TRUE(v == value);
+        EXPECT_FALSE(value != v);
+        EXPECT_FALSE(v < value);
+        EXPECT_TRUE(value <= v);
+        EXPECT_FALSE(v > value);
+        EXPECT_TRUE(value >= v);
+
+        EXPECT_EQ(counters.equal, 1);
+        EXPECT_EQ(counters.not_equal, 1);
+        EXPECT_EQ(counters.less, 1);
+        EXPECT_EQ(counters.less_equal, 1);
+        EXPECT_EQ(counters.greater, 1);
+        EXPECT_EQ(counters.greater_equal, 1);
+
+        // different alternative, value is never compared
+        v = 1;
+        EXPECT_FALSE(v == value);
+        EXPECT_TRUE(v < value);
+        EXPECT_EQ(counters.equal, 1);
+        EXPECT_EQ(counters.less, 1);
+    }
+
+    TEST(hash, hash)
+    {
+        using V = variantx::Variant<int, std::string, double>;
+
+        static_assert(std::is_default_constructible_v<std::hash<V>>);
+        static_assert(!std::is_default_constructible_v<std::hash<variantx::Variant<int, Trivial>>>);
+
+        const std::hash<V> hasher;
+
+        EXPECT_EQ(hasher(V(42)), hasher(V(42)));
+        EXPECT_EQ(hasher(V(std::string("abc"))), hasher(V(std::string("abc"))));
+        EXPECT_NE(hasher(V(42)), hasher(V(43)));
+
+        // Same value in different alternatives
+        using W = variantx::Variant<int, int>;
+        const std::hash<W> w_hasher;
+        EXPECT_NE(w_hasher(W(std::in_place_index<0>, 1)), w_hasher(W(std::in_place_index<1>, 1)));
+
+        std::unordered_set<V> set = {V(1), V(std::string("1")), V(1.0), V(1)};
+        EXPECT_EQ(set.size(), 3);
+        EXPECT_TRUE(set.contains(V(std::string("1"))));
+        EXPECT_FALSE(set.contains(V(2)));
+    }
+
+    TEST(hash, bitwise_hashable)
+    {
+        using V = variantx::Variant<int, unsigned long long, char, const int*>;
+
+        int value = 0;
+
+        std::unordered_map<V, int> map;
+        map[V(1)]      = 1;
+        map[V(1ULL)]   = 2;
+        map[V('a')]    = 3;
+        map[V(&value)] = 4;
+
+        EXPECT_EQ(map.size(), 4);
+        EXPECT_EQ(map.at(V(1)), 1);
+        EXPECT_EQ(map.at(V(1ULL)), 2);
+        EXPECT_EQ(map.at(V('a')), 3);
+        EXPECT_EQ(map.at(V(&value)), 4);
+    }
+
+    TEST(hash, user_hash_of_enum)
+    {
+        static_assert(variantx::impl::kBitwiseHashable<int, char, unsigned long long>);
+        static_assert(!variantx::impl::kBitwiseHashable<int, HashedKey>);
+
+        // The enum's own std::hash is used, not its bytes
+        using V = variantx::Variant<int, HashedKey>;
+        EXPECT_EQ(std::hash<V>()(V(HashedKey::First)), variantx::impl::MixHash(1, 42));
+        EXPECT_EQ(std::hash<V>()(V(HashedKey::Second)), variantx::impl::MixHash(1, 42));
+
+        const std::vector<V> values = {V(HashedKey::First), V(1)};
+        std::vector<std::size_t> hashes(values.size());
+        variantx::HashAll(std::span<const V>(values), std::span<std::size_t>(hashes));
+        EXPECT_EQ(hashes[0], std::hash<V>()(values[0]));
+        EXPECT_EQ(hashes[1], std::hash<V>()(values[1]));
+    }
+
+    TEST(hash, bitwise_per_alternative)
+    {
+        // The int of a mixed variant is hashed as bytes, the string with std::hash
+        using V = variantx::Variant<int, std::string>;
+
+        const int five = 5;
+        EXPECT_EQ(std::hash<V>()(V(five)),
+                  variantx::impl::MixHash(0, variantx::impl::HashBytes(&five, sizeof(five))));
+        EXPECT_EQ(std::hash<V>()(V(std::string("abc"))),
+                  variantx::impl::MixHash(1, std::hash<std::string>()("abc")));
+
+        const std::vector<V> values = {V(five), V(std::string("abc"))};
+        std::vector<std::size_t> hashes(values.size());
+        variantx::HashAll(std::span<const V>(values), std::span<std::size_t>(hashes));
+        EXPECT_EQ(hashes[0], std::hash<V>()(values[0]));
+        EXPECT_EQ(hashes[1], std::hash<V>()(values[1]));
+    }
+
+    TEST(hash, valueless)
+    {
+        using V = variantx::Variant<int, EmptyComparableHashable>;
+
+        V v1, v2;
+        ASSERT_ANY_THROW(v1 = V(std::in_place_index<1>));
+        ASSERT_ANY_THROW(v2 = V(std::in_place_index<1>));
+        ASSERT_TRUE(v1.ValuelessByException());
+
+        EXPECT_EQ(std::hash<V>()(v1), std::hash<V>()(v2));
+    }
+
+    TEST(hash, hash_all)
+    {
+        using V = variantx::Variant<int, std::string, EmptyComparableHashable>;
+
+        std::vector<V> variants;
+        for (int i = 0; i < 100; ++i)
+        {
+            if (i % 3 == 0)
+            {
+                variants.emplace_back(std::to_string(i));
+            }
+            else
+            {
+                variants.emplace_back(i);
+            }
+        }
+
+        ASSERT_ANY_THROW(variants[10] = V(std::in_place_index<2>));
+        ASSERT_TRUE(variants[10].ValuelessByException());
+
+        std::vector<std::size_t> hashes(variants.size());
+        variantx::HashAll(std::span<const V>(variants), std::span<std::size_t>(hashes));
+
+        for (std::size_t i = 0; i < variants.size(); ++i)
+        {
+            EXPECT_EQ(hashes[i], std::hash<V>()(variants[i]));
+        }
+
+        using W = variantx::Variant<int, char>;
+
+        const std::vector<W> trivial = {W(1), W('b'), W(3)};
+        std::vector<std::size_t> trivial_hashes(trivial.size());
+        variantx::HashAll(std::span<const W>(trivial), std::span<std::size_t>(trivial_hashes));
+
+        for (std::size_t i = 0; i < trivial.size(); ++i)
+        {
+            EXPECT_EQ(trivial_hashes[i], std::hash<W>()(trivial[i]));
+        }
+    }
+
+    TEST(cast, widening)
+    {
+        using Narrow = variantx::Variant<int, std::string>;
+        using Wide   = variantx::Variant<double, std::string, char, int>;
+
+        static_assert(std::is_same_v<decltype(variantx::VariantCast<Wide>(Narrow())), Wide>);
+
+        const Narrow number(42);
+        Wide         wide = variantx::VariantCast<Wide>(number);
+        ASSERT_EQ(wide.Index(), 3);
+        EXPECT_EQ(variantx::Get<int>(wide), 42);
+
+        Narrow text(std::string(64, 'a'));
+        const char* data = variantx::Get<1>(text).data();
+
+        wide = variantx::VariantCast<Wide>(std::move(text));
+        ASSERT_EQ(wide.Index(), 1);
+        EXPECT_EQ(variantx::Get<1>(wide).data(), data);
+
+        Narrow valueless;
+        ASSERT_ANY_THROW(
+            valueless.EmplaceWith<1>([]() -> std::string { throw std::exception(); }));
+        EXPECT_ANY_THROW(variantx::VariantCast<Wide>(valueless));
+    }
+
+    TEST(cast, narrowing)
+    {
+        using Wide   = variantx::Variant<double, std::string, char, int>;
+        using Narrow = variantx::Variant<int, std::string>;
+        using Result = std::expected<Narrow, variantx::AccessError>;
+
+        static_assert(std::is_same_v<decltype(variantx::VariantCast<Narrow>(Wide())), Result>);
+
+        const Result text = variantx::VariantCast<Narrow>(Wide(std::string("abc")));
+        ASSERT_TRUE(text.has_value());
+        EXPECT_EQ(variantx::Get<std::string>(*text), "abc");
+
+        const Result number = variantx::VariantCast<Narrow>(Wide(7));
+        ASSERT_TRUE(number.has_value());
+        EXPECT_EQ(variantx::Get<0>(*number), 7);
+
+        const Result character = variantx::VariantCast<Narrow>(Wide('c'));
+        ASSERT_FALSE(character.has_value());
+        EXPECT_EQ(character.error(), variantx::AccessError::WrongAlternative);
+
+        Wide valueless;
+        ASSERT_ANY_THROW(
+            valueless.EmplaceWith<1>([]() -> std::string { throw std::exception(); }));
+        EXPECT_EQ(variantx::VariantCast<Narrow>(valueless).error(),
+                  variantx::AccessError::Valueless);
+    }
+
+    template <typename To, typename From>
+    concept Castable = requires(From from) { variantx::VariantCast<To>(from); };
+
+    static_assert(Castable<variantx::Variant<int, int>, variantx::Variant<char>>);
+    static_assert(!Castable<variantx::Variant<int, int>, variantx::Variant<int>>);
+    static_assert(!Castable<int, variantx::Variant<int>>);
+    static_assert(
+        !Castable<variantx::Variant<OnlyMovable>, const variantx::Variant<OnlyMovable, int>&>);
+
+    static_assert(
+        []
+        {
+            using Wide = variantx::Variant<char, int, double>;
+            return variantx::Get<double>(
+                       variantx::VariantCast<Wide>(variantx::Variant<double, int>(2.0))) == 2.0 &&
+                   variantx::VariantCast<variantx::Variant<int>>(Wide('a')).has_value() == false;
+        }());
+
+    TEST(references, get_and_visit)
+    {
+        std::string text = "abc";
+        int         number = 1;
+
+        using V = variantx::Variant<std::string&, const int&>;
+
+        static_assert(sizeof(V) == sizeof(void*) * 2);
+        static_assert(std::is_trivially_copyable_v<V>);
+        static_assert(!std::is_default_constructible_v<V>);
+        static_assert(!std::is_constructible_v<V, std::string>);
+        static_assert(!std::is_constructible_v<V, int>);
+        static_assert(std::is_same_v<decltype(variantx::Get<0>(std::declval<const V&>())),
+                                     std::string&>);
+        static_assert(std::is_same_v<decltype(variantx::Get<0>(std::declval<V>())), std::string&>);
+
+        V v(text);
+        ASSERT_EQ(v.Index(), 0);
+        EXPECT_EQ(&variantx::Get<0>(v), &text);
+        EXPECT_EQ(variantx::GetIf<std::string&>(&v), &text);
+
+        variantx::Get<0>(v) += "def";
+        EXPECT_EQ(text, "abcdef");
+
+        variantx::Visit(Overload{[](std::string& value) { value += value; }, [](const int&) {}},
+                        v);
+        EXPECT_EQ(text, "abcdefabcdef");
+
+        v = number;
+        ASSERT_EQ(v.Index(), 1);
+        EXPECT_EQ(&variantx::Get<const int&>(v), &number);
+
+        number = 5;
+        const int* address = variantx::Visit(
+            Overload{[](std::string&) -> const int* { return nullptr; },
+                     [](const int& value) { return &value; }},
+            v);
+        EXPECT_EQ(address, &number);
+        EXPECT_EQ(*variantx::TryGet<1>(v), 5);
+        EXPECT_EQ(variantx::TryGet<0>(v).Error(), variantx::AccessError::WrongAlternative);
+    }
+
+    TEST(references, rebinding)
+    {
+        std::string fst = "fst";
+        std::string snd = "snd";
+
+        using V = variantx::Variant<std::string&, int>;
+
+        V a(fst);
+        V b(std::in_place_index<0>, snd);
+
+        a = b;
+        EXPECT_EQ(&variantx::Get<0>(a), &snd);
+        EXPECT_EQ(fst, "fst");
+
+        a = fst;
+        EXPECT_EQ(&variantx::Get<0>(a), &fst);
+        EXPECT_EQ(snd, "snd");
+
+        a.EmplaceOrAssign<0>(snd);
+        EXPECT_EQ(&variantx::Get<0>(a), &snd);
+        EXPECT_EQ(fst, "fst");
+
+        a.Emplace<0>(fst);
+        a.swap(b);
+        EXPECT_EQ(&variantx::Get<0>(a), &snd);
+        EXPECT_EQ(&variantx::Get<0>(b), &fst);
+        EXPECT_EQ(fst, "fst");
+        EXPECT_EQ(snd, "snd");
+
+        a = 42;
+        EXPECT_EQ(variantx::Get<1>(a), 42);
+        EXPECT_EQ(snd, "snd");
+
+        EXPECT_TRUE(b == V(std::in_place_index<0>, fst));
+        using Owning = variantx::Variant<std::string, int>;
+        EXPECT_EQ(std::hash<V>()(b), std::hash<Owning>()(Owning(fst)));
+    }
+
+    TEST(references, rebinding_const)
+    {
+        int fst = 1;
+        int snd = 2;
+
+        using V = variantx::Variant<const int&, double>;
+
+        static_assert(requires(V v, int& value) { v.EmplaceOrAssign<0>(value); });
+        static_assert(std::is_nothrow_assignable_v<V&, int&>);
+        static_assert(!std::is_assignable_v<V&, int&&>);
+
+        V v(fst);
+        v = snd;
+        EXPECT_EQ(&variantx::Get<0>(v), &snd);
+
+        v.EmplaceOrAssign<0>(fst);
+        EXPECT_EQ(&variantx::Get<0>(v), &fst);
+
+        v.EmplaceOrAssign<const int&>(snd);
+        EXPECT_EQ(&variantx::Get<0>(v), &snd);
+        EXPECT_EQ(fst, 1);
+        EXPECT_EQ(snd, 2);
+    }
+
+    static_assert(
+        []
+        {
+            int fst = 1;
+            int snd = 2;
+
+            variantx::Variant<int&, double> v(fst);
+            v.Emplace<0>(snd);
+            variantx::Get<0>(v) = 3;
+            return fst == 1 && snd == 3;
+        }());
+
+    TEST(variant_ref, binding)
+    {
+        using V = variantx::Variant<int, std::string>;
+
+        static_assert(sizeof(variantx::VariantRef<int, std::string>) == sizeof(void*) * 2);
+        static_assert(std::is_trivially_copyable_v<variantx::VariantRef<int, std::string>>);
+        static_assert(!std::is_constructible_v<variantx::VariantRef<int, std::string>, const V&>);
+        static_assert(!std::is_constructible_v<variantx::ConstVariantRef<int, std::string>, V>);
+        static_assert(!std::is_constructible_v<variantx::VariantRef<int, std::string>, int>);
+
+        std::string text = "abc";
+
+        const auto size = [](variantx::ConstVariantRef<int, std::string> ref)
+        {
+            return variantx::Visit(Overload{[](const int&) -> std::size_t { return 1; },
+                                            [](const std::string& value) { return value.size(); }},
+                                   ref);
+        };
+
+        // No Variant is constructed, no copy of the string
+        const int one = 1;
+        EXPECT_EQ(size(text), 3);
+        EXPECT_EQ(size(one), 1);
+
+        V variant(std::string("abcdef"));
+        EXPECT_EQ(size(variant), 6);
+        EXPECT_EQ(size(std::as_const(variant)), 6);
+
+        variantx::VariantRef ref = variant;
+        static_assert(std::is_same_v<decltype(ref), variantx::VariantRef<int, std::string>>);
+        EXPECT_EQ(ref.Index(), 1);
+        EXPECT_EQ(&variantx::Get<1>(ref), &variantx::Get<1>(variant));
+        EXPECT_EQ(&variantx::Get<std::string&>(ref), &variantx::Get<1>(variant));
+
+        variantx::Get<1>(ref) = "xyz";
+        EXPECT_EQ(variantx::Get<1>(variant), "xyz");
+
+        ref = text;
+        EXPECT_EQ(&variantx::Get<1>(ref), &text);
+        EXPECT_EQ(variantx::Get<1>(variant), "xyz");
+
+        int number = 5;
+        ref        = number;
+        EXPECT_EQ(ref.Index(), 0);
+        EXPECT_TRUE(ref == variantx::VariantRef<int, std::string>(number));
+    }
+
+    TEST(variant_ref, valueless)
+    {
+        using V = variantx::Variant<int, std::string>;
+
+        V variant;
+        ASSERT_ANY_THROW(variant.EmplaceWith<1>([]() -> std::string { throw std::exception(); }));
+
+        using Ref = variantx::ConstVariantRef<int, std::string>;
+        EXPECT_ANY_THROW(Ref{variant});
+    }
+
+    static_assert(
+        []
+        {
+            variantx::Variant<int, double> variant(2.0);
+            variantx::VariantRef<int, double> ref(variant);
+            variantx::Get<double>(variant) = 3.0;
+            return variantx::Visit([](auto value) { return value == 3.0; }, ref);
+        }());
+
+    struct Json;
+
+    struct JsonArray
+    {
+        std::vector<Json> items;
+    };
+
+    struct Json : variantx::Variant<std::nullptr_t, double, std::string,
+                                    variantx::Recursive<JsonArray>>
+    {
+        using Variant::Variant;
+    };
+
+    TEST(recursive, visit_sees_through)
+    {
+        static_assert(std::is_trivially_copyable_v<variantx::Recursive<JsonArray>>);
+
+        variantx::Arena arena;
+
+        Json document{variantx::Recursive<JsonArray>(arena)};
+        auto& root = *variantx::Get<3>(document);
+
+        root.items.emplace_back(1.5);
+        root.items.emplace_back(std::string("abc"));
+        root.items.emplace_back(variantx::Recursive<JsonArray>(arena));
+        variantx::Get<3>(root.items.back())->items.emplace_back(nullptr);
+
+        struct Count
+        {
+            std::size_t operator()(std::nullptr_t) const { return 1; }
+            std::size_t operator()(double) const { return 1; }
+            std::size_t operator()(const std::string&) const { return 1; }
+            std::size_t operator()(const JsonArray& array) const
+            {
+                std::size_t result = 1;
+                for (const auto& item : array.items)
+                {
+                    result += variantx::Visit(*this, item);
+                }
+                return result;
+            }
+        };
+
+        const Json& const_document = document;
+        EXPECT_EQ(variantx::Visit(Count{}, const_document), 5);
+
+        variantx::Visit(Overload{[](JsonArray& array) { array.items.clear(); }, [](auto&) {}},
+                        document);
+        EXPECT_EQ(variantx::Visit(Count{}, const_document), 1);
+    }
+
+    TEST(recursive, compares_nodes)
+    {
+        struct Node
+        {
+            int value;
+
+            auto operator<=>(const Node&) const = default;
+        };
+
+        using V = variantx::Variant<int, variantx::Recursive<Node>>;
+        static_assert(!variantx::impl::kBitwiseEqualityComparable<int, variantx::Recursive<Node>>);
+
+        variantx::Arena arena;
+
+        // Different nodes with equal values
+        const V lhs(variantx::Recursive<Node>(arena, 1));
+        const V rhs(variantx::Recursive<Node>(arena, 1));
+        const V bigger(variantx::Recursive<Node>(arena, 2));
+
+        EXPECT_TRUE(lhs == rhs);
+        EXPECT_FALSE(lhs != rhs);
+        EXPECT_FALSE(lhs < rhs);
+        EXPECT_TRUE(lhs != bigger);
+        EXPECT_TRUE(lhs < bigger);
+    }
+
+    TEST(recursive, visit_keeps_shared_node)
+    {
+        using Node = std::vector<std::string>;
+        using V    = variantx::Variant<int, variantx::Recursive<Node>>;
+
+        struct Category
+        {
+            int operator()(int) const { return 0; }
+            int operator()(Node&) const { return 1; }
+            int operator()(const Node&) const { return 2; }
+            int operator()(Node&& node) const
+            {
+                const Node stolen = std::move(node);
+                return 3;
+            }
+        };
+
+        variantx::Arena arena;
+        V               variant(variantx::Recursive<Node>(arena, Node{"a"}));
+        const V         copy = variant;
+
+        EXPECT_EQ(variantx::Visit(Category{}, variant), 1);
+        EXPECT_EQ(variantx::Visit(Category{}, std::as_const(variant)), 2);
+
+        // The node is shared with `copy`: an rvalue variant still passes it as an lvalue
+        EXPECT_EQ(variantx::Visit(Category{}, std::move(variant)), 1);
+        EXPECT_EQ(variantx::Visit(Overload{[](int) -> std::size_t { return 0; },
+                                           [](Node node) { return node.size(); }},
+                                  std::move(variant)),
+                  1);
+        EXPECT_EQ(*variantx::Get<1>(copy), Node{"a"});
+    }
+
+    TEST(recursive, arena)
+    {
+        static std::size_t alive = 0;
+
+        struct Tracked
+        {
+            Tracked() { ++alive; }
+            ~Tracked() { --alive; }
+
+            Tracked(const Tracked&)            = delete;
+            Tracked& operator=(const Tracked&) = delete;
+        };
+
+        {
+            variantx::Arena arena(64);
+
+            for (int i = 0; i < 100; ++i)
+            {
+                arena.Create<Tracked>();
+                auto* numbers = arena.CreateArray<std::uint64_t>(10);
+                EXPECT_EQ(reinterpret_cast<std::uintptr_t>(numbers) % alignof(std::uint64_t), 0);
+                EXPECT_EQ(numbers[9], 0);
+            }
+
+            arena.CreateArray<Tracked>(3);
+            EXPECT_EQ(alive, 103);
+            EXPECT_GE(arena.BytesUsed(), 100 * (sizeof(Tracked) + 10 * sizeof(std::uint64_t)));
+        }
+
+        EXPECT_EQ(alive, 0);
+    }
+
+    TEST(shared, copy_on_write)
+    {
+        using Table  = std::vector<std::string>;
+        using Config = variantx::Variant<int, variantx::Shared<Table>>;
+
+        Config config(Table{"a", "b"});
+        ASSERT_EQ(config.Index(), 1);
+
+        // Copies share the table
+        const Config copy = config;
+        const Table* table = &*variantx::Get<1>(copy);
+        EXPECT_EQ(variantx::Get<1>(config).UseCount(), 2);
+        EXPECT_EQ(&*std::as_const(variantx::Get<1>(config)), table);
+
+        // Const visit reads the payload in place
+        const Config& const_config = config;
+        EXPECT_EQ(variantx::Visit(Overload{[](const Table& value) { return &value; },
+                                           [](int) -> const Table* { return nullptr; }},
+                                  const_config),
+                  table);
+        EXPECT_EQ(variantx::Get<1>(copy).UseCount(), 2);
+
+        // Mutation clones once, the copy keeps the old table
+        variantx::Get<1>(config)->push_back("c");
+        EXPECT_NE(&*std::as_const(variantx::Get<1>(config)), table);
+        EXPECT_EQ(variantx::Get<1>(config).UseCount(), 1);
+        EXPECT_EQ(variantx::Get<1>(copy)->size(), 2);
+        EXPECT_EQ(variantx::Get<1>(config)->size(), 3);
+
+        // Non-const visit clones a shared payload, whatever the visitor takes
+        Config shared = copy;
+        variantx::Visit(Overload{[](auto& value) { value.push_back("d"); }, [](int&) {}}, shared);
+        EXPECT_EQ(variantx::Get<1>(copy).UseCount(), 1);
+        EXPECT_EQ(variantx::Get<1>(copy)->size(), 2);
+        EXPECT_EQ(variantx::Get<1>(shared)->size(), 3);
+
+        // Unique: non-const visit mutates in place
+        const Table* unique = &*std::as_const(variantx::Get<1>(config));
+        variantx::Visit(Overload{[](Table& value) { value.pop_back(); }, [](int) {}}, config);
+        EXPECT_EQ(&*std::as_const(variantx::Get<1>(config)), unique);
+
+        EXPECT_TRUE(config == copy);
+
+        config = 1;
+        EXPECT_EQ(variantx::Get<1>(copy).UseCount(), 1);
+    }
+
+    TEST(shared, escaped_reference)
+    {
+        using Table = std::vector<std::string>;
+
+        variantx::Shared<Table> box(Table{"a"});
+
+        // The reference outlives the non-const access, the next copy must not see its writes
+        Table&                        table = *box;
+        const variantx::Shared<Table> copy  = box;
+        table.push_back("b");
+
+        EXPECT_EQ(box.UseCount(), 1);
+        EXPECT_EQ(copy.UseCount(), 1);
+        EXPECT_EQ(copy->size(), 1);
+        EXPECT_EQ(std::as_const(box)->size(), 2);
+
+        // A box only read from is shared as before
+        const variantx::Shared<Table> second = copy;
+        EXPECT_EQ(copy.UseCount(), 2);
+        EXPECT_EQ(&*second, &*copy);
+    }
+
+    TEST(shared, overloaded_address_of)
+    {
+        struct Sneaky
+        {
+            int value;
+
+            void operator&() const = delete;
+        };
+
+        variantx::Shared<Sneaky> box(Sneaky{1});
+        EXPECT_EQ(std::as_const(box)->value, 1);
+
+        box->value = 2;
+        EXPECT_EQ((*box).value, 2);
+    }
+
+    TEST(shared, moved_from)
+    {
+        using Table = std::vector<std::string>;
+
+        variantx::Shared<Table> box(Table{"a"});
+        const variantx::Shared<Table> moved = std::move(box);
+        EXPECT_EQ(moved.UseCount(), 1);
+
+        // Copies of a moved-from box hold nothing either
+        const variantx::Shared<Table> copy = box;
+        EXPECT_EQ(box.UseCount(), 0);
+        EXPECT_EQ(copy.UseCount(), 0);
+
+        EXPECT_THROW(static_cast<void>(*copy), variantx::BadVariantAccess);
+        EXPECT_THROW(static_cast<void>(box->size()), variantx::BadVariantAccess);
+        EXPECT_THROW(static_cast<void>(copy == moved), variantx::BadVariantAccess);
+
+        box = moved;
+        EXPECT_EQ(moved.UseCount(), 2);
+        EXPECT_EQ(box->size(), 1);
+        EXPECT_EQ(moved.UseCount(), 1);
+    }
+
+    TEST(monostate, relops_and_hash)
+    {
+        using variantx::Monostate;
+
+        static_assert(std::is_empty_v<Monostate>);
+        static_assert(Monostate() == Monostate());
+        static_assert(!(Monostate() < Monostate()) && Monostate() <= Monostate());
+        static_assert((Monostate() <=> Monostate()) == std::strong_ordering::equal);
+
+        EXPECT_EQ(std::hash<Monostate>()(Monostate()), std::hash<Monostate>()(Monostate()));
+
+        static_assert(
+            std::is_default_constructible_v<variantx::Variant<Monostate, NoDefaultConstructor>>);
+
+        using V = variantx::Variant<Monostate, std::string, int>;
+
+        V empty;
+        EXPECT_EQ(empty.Index(), 0);
+        EXPECT_TRUE(empty == V());
+        EXPECT_TRUE(empty < V(1));
+        EXPECT_TRUE(empty == Monostate());
+
+        using W = variantx::Variant<Monostate, int>;
+        EXPECT_EQ(std::hash<W>()(W()), std::hash<W>()(W(Monostate())));
+        EXPECT_NE(std::hash<W>()(W()), std::hash<W>()(W(0)));
+    }
+
+    TEST(monostate, compact_discriminator)
+    {
+        struct Red
+        {
+        };
+        struct Green
+        {
+        };
+
+        // Tag only variants: the discriminator and a single byte of empty storage
+        using Color = variantx::Variant<variantx::Monostate, Red, Green>;
+        static_assert(sizeof(Color) == 2);
+        static_assert(sizeof(variantx::Variant<int, char>) == sizeof(int) * 2);
+        static_assert(sizeof(variantx::Variant<std::int64_t, double>) == 16);
+
+        Color color(Green{});
+        EXPECT_EQ(color.Index(), 2);
+
+        const auto name = variantx::Visit(
+            Overload{[](variantx::Monostate) { return "none"; }, [](Red) { return "red"; },
+                     [](Green) { return "green"; }},
+            color);
+        EXPECT_EQ(std::string(name), "green");
+
+        color.Emplace<Red>();
+        EXPECT_EQ(color.Index(), 1);
+
+        ASSERT_ANY_THROW(color.EmplaceWith<Green>([]() -> Green { throw std::exception(); }));
+        EXPECT_TRUE(color.ValuelessByException());
+        EXPECT_EQ(color.Index(), variantx::kVariantNpos);
+    }
+
+    TEST(flatten, type)
+    {
+        using variantx::FlattenVariantType;
+        using variantx::Variant;
+
+        static_assert(std::is_same_v<FlattenVariantType<Variant<int, char>>, Variant<int, char>>);
+        static_assert(std::is_same_v<FlattenVariantType<Variant<Variant<int, char>, double>>,
+                                     Variant<int, char, double>>);
+        using Deep = Variant<char, Variant<int, Variant<char, long>>, int>;
+        static_assert(std::is_same_v<FlattenVariantType<Deep>, Variant<char, int, long>>);
+        static_assert(std::is_same_v<FlattenVariantType<Variant<int, const int>>,
+                                     Variant<int, const int>>);
+        static_assert(sizeof(FlattenVariantType<Variant<Variant<int, char>, char>>) <
+                      sizeof(Variant<Variant<int, char>, char>));
+    }
+
+    TEST(flatten, conversion)
+    {
+        using Inner  = variantx::Variant<int, std::string>;
+        using Nested = variantx::Variant<double, Inner, int>;
+        using Flat   = variantx::FlattenVariantType<Nested>;
+
+        static_assert(std::is_same_v<Flat, variantx::Variant<double, int, std::string>>);
+
+        EXPECT_EQ(variantx::Get<double>(variantx::Flatten(Nested(1.5))), 1.5);
+        EXPECT_EQ(variantx::Get<int>(variantx::Flatten(Nested(std::in_place_index<2>, 3))), 3);
+
+        const Nested number(Inner(4));
+        EXPECT_EQ(variantx::Get<int>(variantx::Flatten(number)), 4);
+
+        Nested      text(Inner(std::string(64, 'a')));
+        const char* data = variantx::Get<1>(variantx::Get<1>(text)).data();
+
+        Flat flat = variantx::Flatten(std::move(text));
+        ASSERT_EQ(flat.Index(), 2);
+        EXPECT_EQ(variantx::Get<2>(flat).data(), data);
+
+        Nested valueless(Inner(1));
+        ASSERT_ANY_THROW(variantx::Get<1>(valueless).EmplaceWith<1>(
+            []() -> std::string { throw std::exception(); }));
+        EXPECT_ANY_THROW(variantx::Flatten(valueless));
+    }
+
+    static_assert(
+        []
+        {
+            using Nested = variantx::Variant<variantx::Variant<int, char>, char>;
+            return variantx::Get<char>(variantx::Flatten(Nested('a'))) == 'a' &&
+                   variantx::Flatten(Nested(variantx::Variant<int, char>('b'))).Index() == 1;
+        }());
+
+    static_assert(variantx::Variant<int, double>(1) == 1);
+    static_assert(variantx::Variant<int, double>(1) < 0.0);
+
     static_assert(
         []
         {
@@ -0,0 +1,284 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <headers/variantx-scan.hpp>
+#include <headers/variantx-sort.hpp>
+#include <headers/variantx-views.hpp>
+#include <list>
+#include <ranges>
+#include <deque>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "../utils/basic/throw.hpp"
+
+namespace
+{
+    namespace vx = variantx;
+
+    using Message = vx::Variant<int, double, std::string, test_basic::ThrowOnCopy>;
+
+    // Random alternatives 0..2 and a few valueless elements
+    std::vector<Message> MakeMessages(std::size_t size)
+    {
+        std::mt19937                               rng(7);  // NOLINT -> fixed seed
+        std::uniform_int_distribution<std::size_t> pick(0, 31);
+
+        std::vector<Message> messages(size);
+        for (auto& message : messages)
+        {
+            const std::size_t roll = pick(rng);
+            if (roll < 16)  // NOLINT
+            {
+                message.Emplace<0>(1);
+            }
+            else if (roll < 28)  // NOLINT
+            {
+                message.Emplace<1>(0.5);
+            }
+            else if (roll < 31)  // NOLINT
+            {
+                message.Emplace<2>("quote");
+            }
+            else
+            {
+                const test_basic::ThrowOnCopy value(0);
+                EXPECT_ANY_THROW(message.Emplace<3>(value));
+            }
+        }
+        return messages;
+    }
+}  // namespace
+
+TEST(Scan, MatchesIndex)
+{
+    // Sizes around the 8-lane blocks of the vector kernels
+    for (const std::size_t size : {0, 1, 7, 8, 9, 16, 17, 1000})
+    {
+        const std::vector<Message> messages = MakeMessages(size);
+
+        std::array<std::size_t, 4> expected{};
+        std::size_t                valueless = 0;
+        std::vector<std::size_t>   strings;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            if (messages[i].ValuelessByException())
+            {
+                ++valueless;
+                continue;
+            }
+
+            ++expected[messages[i].Index()];
+            if (messages[i].Index() == 2)
+            {
+                strings.push_back(i);
+            }
+        }
+
+        EXPECT_EQ(vx::IndexHistogram(messages), expected);
+        EXPECT_EQ(vx::CountAlternative<0>(messages), expected[0]);
+        EXPECT_EQ(vx::CountAlternative<double>(messages), expected[1]);
+        EXPECT_EQ(vx::CountAlternative<vx::kVariantNpos>(messages), valueless);
+        EXPECT_EQ(vx::PositionsOf<std::string>(messages), strings);
+
+        for (std::size_t from = 0; from < size; from += 5)  // NOLINT
+        {
+            const auto next = std::lower_bound(strings.begin(), strings.end(), from);
+            EXPECT_EQ(vx::FindAlternative<2>(messages, from),
+                      next == strings.end() ? vx::kVariantNpos : *next);
+        }
+        EXPECT_EQ(vx::FindAlternative<2>(messages, size), vx::kVariantNpos);
+    }
+}
+
+TEST(Scan, Ranges)
+{
+    // Too small for a gather, always the scalar loop
+    using Small = vx::Variant<char, bool>;
+    static_assert(sizeof(Small) == 2);
+
+    const Small small[] = {'a', true, 'b', false, true};  // NOLINT -> c-style array
+    EXPECT_EQ(vx::CountAlternative<bool>(small), 3);
+    EXPECT_EQ(vx::FindAlternative<0>(small, 1), 2);
+    EXPECT_EQ(vx::PositionsOf<1>(small), (std::vector<std::size_t>{1, 3, 4}));
+
+    std::vector<vx::Variant<int, double>> numbers(100, 1);
+    numbers[42] = 2.0;
+
+    const std::span<const vx::Variant<int, double>> view(numbers);
+    EXPECT_EQ(vx::CountAlternative<int>(view), 99);
+    EXPECT_EQ(vx::FindAlternative<double>(view.subspan(10)), 32);
+    EXPECT_EQ(vx::IndexHistogram(std::span(numbers).first(42)), (std::array<std::size_t, 2>{42}));
+}
+
+TEST(Sort, ByIndex)
+{
+    std::vector<Message> messages = MakeMessages(500);
+    const auto           expected = vx::IndexHistogram(messages);
+
+    const auto starts = vx::SortByIndex(messages);
+    ASSERT_EQ(starts.size(), 5);
+    EXPECT_EQ(starts[4], messages.size());
+
+    for (std::size_t index = 0; index < 3; ++index)
+    {
+        EXPECT_EQ(starts[index + 1] - starts[index], expected[index]);
+        for (std::size_t i = starts[index]; i < starts[index + 1]; ++i)
+        {
+            EXPECT_EQ(messages[i].Index(), index);
+        }
+    }
+
+    // Valueless first, as operator< orders them
+    for (std::size_t i = 0; i < starts[0]; ++i)
+    {
+        EXPECT_TRUE(messages[i].ValuelessByException());
+    }
+}
+
+TEST(Sort, StablePartition)
+{
+    using Number = vx::Variant<int, double>;
+
+    std::deque<Number> numbers;
+    for (int i = 0; i < 100; ++i)  // NOLINT
+    {
+        if (i % 3 == 0)
+        {
+            numbers.emplace_back(static_cast<double>(i));
+        }
+        else
+        {
+            numbers.emplace_back(i);
+        }
+    }
+
+    const auto starts = vx::StablePartitionByIndex(numbers);
+    EXPECT_EQ(starts, (std::array<std::size_t, 3>{0, 66, 100}));
+
+    EXPECT_TRUE(std::is_sorted(numbers.begin(), numbers.begin() + 66));
+    EXPECT_TRUE(std::is_sorted(numbers.begin() + 66, numbers.end()));
+    EXPECT_EQ(vx::Get<int>(numbers.front()), 1);
+    EXPECT_EQ(vx::Get<double>(numbers.back()), 99.0);
+}
+
+TEST(Sort, MatchesOperatorLess)
+{
+    using Value = vx::Variant<int, std::string, double>;
+
+    std::mt19937                       rng(11);  // NOLINT -> fixed seed
+    std::uniform_int_distribution<int> pick(0, 1000);
+
+    std::vector<Value> values;
+    for (int i = 0; i < 1000; ++i)  // NOLINT
+    {
+        const int value = pick(rng);
+        switch (value % 3)
+        {
+            case 0:
+                values.emplace_back(value);
+                break;
+            case 1:
+                values.emplace_back(std::to_string(value));
+                break;
+            default:
+                values.emplace_back(value * 0.5);
+                break;
+        }
+    }
+
+    std::vector<Value> expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    vx::Sort(values);
+    EXPECT_EQ(values, expected);
+
+#if defined(__cpp_lib_execution)
+    std::shuffle(values.begin(), values.end(), rng);
+    // The sequential policy, parallel ones need the backend of the standard library linked
+    vx::Sort(std::execution::seq, std::span(values));
+    EXPECT_EQ(values, expected);
+#endif
+}
+
+TEST(Views, Alternative)
+{
+    std::vector<Message> messages = MakeMessages(200);
+
+    std::vector<std::size_t> expected;
+    std::size_t              position = 0;
+    for (auto& value : messages | vx::views::alternative<std::string>)
+    {
+        static_assert(std::is_same_v<decltype(value), std::string&>);
+        value += "!";
+    }
+    for (const auto& message : messages)
+    {
+        if (message.Index() == 2)
+        {
+            EXPECT_EQ(vx::Get<2>(message), "quote!");
+            expected.push_back(position);
+        }
+        ++position;
+    }
+
+    auto view = std::as_const(messages) | vx::views::alternative_index<2>;
+    static_assert(std::ranges::forward_range<decltype(view)>);
+    static_assert(std::ranges::borrowed_range<decltype(view)>);
+    static_assert(std::is_same_v<std::ranges::range_reference_t<decltype(view)>,
+                                 const std::string&>);
+
+    std::vector<std::size_t> positions;
+    for (auto it = view.begin(); it != view.end(); ++it)
+    {
+        positions.push_back(it.Position());
+    }
+    EXPECT_EQ(positions, expected);
+    EXPECT_EQ(static_cast<std::size_t>(std::ranges::distance(view)),
+              vx::CountAlternative<2>(messages));
+
+    // Not contiguous: std::views::filter underneath
+    std::list<vx::Variant<int, double>> list = {1, 2.5, 3, 4.5};
+    double sum = 0;
+    for (const double value : list | vx::views::alternative<double>)
+    {
+        sum += value;
+    }
+    EXPECT_EQ(sum, 7.0);
+}
+
+TEST(Views, IndicesAndVisit)
+{
+    const std::vector<vx::Variant<int, std::string>> values = {1, "ab", 3, "cde"};
+
+    std::vector<std::size_t> indices;
+    std::ranges::copy(values | vx::views::indices, std::back_inserter(indices));
+    EXPECT_EQ(indices, (std::vector<std::size_t>{0, 1, 0, 1}));
+
+    auto sizes = values | vx::views::visit(
+                              [](const auto& value) -> std::size_t
+                              {
+                                  if constexpr (std::is_same_v<std::decay_t<decltype(value)>, int>)
+                                  {
+                                      return static_cast<std::size_t>(value);
+                                  }
+                                  else
+                                  {
+                                      return value.size();
+                                  }
+                              });
+    EXPECT_EQ(std::vector<std::size_t>(sizes.begin(), sizes.end()),
+              (std::vector<std::size_t>{1, 2, 3, 3}));
+
+    // Composes with std::views
+    std::vector<int> doubled;
+    std::ranges::copy(values | vx::views::alternative<int> |
+                          std::views::transform([](int value) { return value * 2; }),
+                      std::back_inserter(doubled));
+    EXPECT_EQ(doubled, (std::vector<int>{2, 6}));
+}
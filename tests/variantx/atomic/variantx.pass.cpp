@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <headers/variantx-atomic.hpp>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    namespace vx = variantx;
+
+    struct Idle
+    {
+    };
+
+    struct Running
+    {
+        std::uint64_t id;
+    };
+
+    struct Failed
+    {
+        std::int32_t code;
+    };
+
+    // Padding between `flag` and `value`
+    struct Padded
+    {
+        char         flag;
+        std::int32_t value;
+    };
+
+    using Small = vx::AtomicVariant<Idle, std::int32_t, Failed>;
+    using State = vx::AtomicVariant<Idle, Running, Failed>;
+}  // namespace
+
+TEST(AtomicVariant, SingleThread)
+{
+    static_assert(Small::kIsAlwaysLockFree);
+    static_assert(State::kIsAlwaysLockFree);
+    static_assert(!std::is_copy_constructible_v<State>);
+
+    State state;
+    EXPECT_EQ(state.Index(), 0);
+
+    state.Store(Running{42});
+    EXPECT_EQ(state.Index(), 1);
+    EXPECT_EQ(vx::Get<Running>(state.Load()).id, 42);
+
+    const auto previous = state.Exchange(Failed{-1});
+    EXPECT_EQ(vx::Get<Running>(previous).id, 42);
+    EXPECT_EQ(vx::Get<Failed>(state.Load()).code, -1);
+
+    State::ValueType expected = Idle();
+    EXPECT_FALSE(state.CompareExchange(expected, Running{7}));
+    EXPECT_EQ(vx::Get<Failed>(expected).code, -1);
+    EXPECT_TRUE(state.CompareExchange(expected, Running{7}));
+    EXPECT_EQ(vx::Get<Running>(state.Load()).id, 7);
+
+    const std::uint64_t id = state.Visit(
+        [](const auto& value) -> std::uint64_t
+        {
+            if constexpr (std::is_same_v<std::decay_t<decltype(value)>, Running>)
+            {
+                return value.id;
+            }
+            else
+            {
+                return 0;
+            }
+        });
+    EXPECT_EQ(id, 7);
+
+    Small small(3);
+    Small::ValueType small_expected = 3;
+    EXPECT_TRUE(small.CompareExchange(small_expected, Failed{2}, std::memory_order_acq_rel,
+                                      std::memory_order_acquire));
+    EXPECT_EQ(small.Index(std::memory_order_relaxed), 2);
+}
+
+// Only where the padding can be cleared
+#if VARIANTX_HAS_CLEAR_PADDING
+TEST(AtomicVariant, CompareExchangeIgnoresPadding)
+{
+    vx::AtomicVariant<Padded, Idle> padded(Padded{'a', 1});
+
+    // Equal values written through different padding bytes still compare equal
+    vx::Variant<Padded, Idle> expected(Idle{});
+    auto&                     value = expected.Emplace<Padded>();
+    std::memset(static_cast<void*>(&value), 0xFF, sizeof(value));  // NOLINT
+    value.flag  = 'a';
+    value.value = 1;
+
+    EXPECT_TRUE(padded.CompareExchange(expected, Idle{}));
+    EXPECT_EQ(padded.Index(), 1);
+}
+#endif
+
+TEST(AtomicVariant, Concurrent)
+{
+    constexpr std::size_t kThreads    = 4;
+    constexpr std::size_t kIncrements = 10000;
+
+    // Running{n} is bumped with CAS loops, no update may be lost
+    State state(Running{0});
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < kThreads; ++t)
+    {
+        threads.emplace_back(
+            [&state]
+            {
+                for (std::size_t i = 0; i < kIncrements; ++i)
+                {
+                    State::ValueType current = state.Load(std::memory_order_relaxed);
+                    while (!state.CompareExchange(
+                        current, Running{vx::Get<Running>(current).id + 1}))
+                    {
+                    }
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(vx::Get<Running>(state.Load()).id, kThreads * kIncrements);
+}
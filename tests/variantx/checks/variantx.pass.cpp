@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include <headers/variantx.hpp>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "../utils/basic/throw.hpp"
+
+// Built with VARIANTX_CHECKS=abort
+
+TEST(Checks, GetAborts)
+{
+    namespace vx = variantx;
+
+    vx::Variant<int, std::string> variant(42);
+
+    EXPECT_EQ(vx::Get<0>(variant), 42);
+    EXPECT_DEATH({ [[maybe_unused]] auto& value = vx::Get<1>(variant); }, "");
+    EXPECT_DEATH({ [[maybe_unused]] auto& value = vx::Get<std::string>(variant); }, "");
+}
+
+TEST(Checks, VisitAborts)
+{
+    namespace vx = variantx;
+    namespace tu = test_basic;
+
+    vx::Variant<int, tu::ThrowOnCopy> variant;
+
+    const tu::ThrowOnCopy value(1);
+    EXPECT_ANY_THROW(variant.Emplace<1>(value));
+    ASSERT_TRUE(variant.ValuelessByException());
+
+    EXPECT_DEATH(vx::Visit([](const auto&) {}, variant), "");
+}
+
+TEST(Checks, GetUnchecked)
+{
+    namespace vx = variantx;
+
+    vx::Variant<int, std::string> variant(std::string("abc"));
+    const auto&                   const_variant = variant;
+
+    static_assert(std::is_same_v<decltype(vx::GetUnchecked<1>(variant)), std::string&>);
+    static_assert(std::is_same_v<decltype(vx::GetUnchecked<1>(std::move(variant))),
+                                 std::string&&>);
+    static_assert(
+        std::is_same_v<decltype(vx::GetUnchecked<1>(const_variant)), const std::string&>);
+    static_assert(std::is_same_v<decltype(vx::GetUnchecked<std::string>(std::move(const_variant))),
+                                 const std::string&&>);
+    static_assert(noexcept(vx::GetUnchecked<1>(variant)));
+
+    EXPECT_EQ(vx::GetUnchecked<1>(variant), "abc");
+    EXPECT_EQ(vx::GetUnchecked<std::string>(const_variant), "abc");
+
+    vx::GetUnchecked<std::string>(variant) = "def";
+    EXPECT_EQ(vx::Get<1>(variant), "def");
+
+    std::string moved = vx::GetUnchecked<1>(std::move(variant));
+    EXPECT_EQ(moved, "def");
+}
+
+TEST(Checks, VisitUnchecked)
+{
+    namespace vx = variantx;
+
+    vx::Variant<int, std::string> fst(42);
+    vx::Variant<int, std::string> snd(std::string("abc"));
+
+    const auto size = [](const auto& value)
+    {
+        if constexpr (std::is_same_v<std::remove_cvref_t<decltype(value)>, int>)
+        {
+            return std::size_t{1};
+        }
+        else
+        {
+            return value.size();
+        }
+    };
+
+    EXPECT_EQ(vx::VisitUnchecked(size, fst), 1);
+    EXPECT_EQ(vx::VisitUnchecked(size, snd), 3);
+    EXPECT_EQ(vx::VisitUnchecked<int>([](const auto&, const auto&) { return 2; }, fst, snd), 2);
+}
+
+static_assert(
+    []
+    {
+        variantx::Variant<int, double> variant(2.0);
+        return variantx::GetUnchecked<double>(variant) == 2.0 &&
+               variantx::VisitUnchecked([](auto value) { return value > 1; }, variant);
+    }());
@@ -0,0 +1,373 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <headers/variantx-collection.hpp>
+#include <headers/variantx-index-array.hpp>
+#include <headers/variantx-packed-buffer.hpp>
+#include <headers/variantx-vector.hpp>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+TEST(VariantVector, DenseStorage)
+{
+    namespace vx = variantx;
+    using Vector = vx::VariantVector<int, std::string, double>;
+
+    static_assert(Vector::IndexArray::kBits == 2);
+
+    Vector vector;
+    EXPECT_TRUE(vector.Empty());
+
+    vector.PushBack(1);
+    vector.PushBack(std::string("a"));
+    vector.EmplaceBack<double>(2.5);
+    vector.EmplaceBack<0>(3);
+    vector.EmplaceBack<std::string>(2, 'b');
+
+    ASSERT_EQ(vector.Size(), 5);
+    EXPECT_EQ(vector.Index(0), 0);
+    EXPECT_EQ(vector.Index(1), 1);
+    EXPECT_EQ(vector.Index(2), 2);
+    EXPECT_EQ(vector.Index(3), 0);
+    EXPECT_EQ(vector.Index(4), 1);
+
+    ASSERT_EQ(vector.Pool<0>().size(), 2);
+    EXPECT_EQ(vector.Pool<0>()[0], 1);
+    EXPECT_EQ(vector.Pool<0>()[1], 3);
+    ASSERT_EQ(vector.Pool<1>().size(), 2);
+    EXPECT_EQ(vector.Pool<1>()[1], "bb");
+    ASSERT_EQ(vector.Pool<2>().size(), 1);
+
+    const vx::Variant<int, std::string, double> variant(std::string("c"));
+    vector.PushBack(variant);
+    EXPECT_EQ(vector.Index(5), 1);
+    EXPECT_EQ(vector.Pool<1>().back(), "c");
+
+    EXPECT_EQ(vector.FindFirst<2>(), 2);
+    EXPECT_EQ(vector.FindFirst<1>(2), 4);
+    EXPECT_EQ(vector.FindFirst<2>(3), Vector::IndexArray::kNotFound);
+    EXPECT_EQ(vector.Indices().Count(1), 3);
+
+    vector.Clear();
+    EXPECT_TRUE(vector.Empty());
+    EXPECT_TRUE(vector.Pool<1>().empty());
+}
+
+TEST(VariantVector, Subscript)
+{
+    namespace vx = variantx;
+    using Vector = vx::VariantVector<int, std::string>;
+
+    Vector vector;
+    vector.PushBack(std::string("abc"));
+    vector.PushBack(7);
+
+    static_assert(std::is_same_v<decltype(vector[0]), vx::VariantRef<int, std::string>>);
+    static_assert(std::is_same_v<decltype(std::as_const(vector)[0]),
+                                 vx::ConstVariantRef<int, std::string>>);
+
+    auto first = vector[0];
+    ASSERT_EQ(first.Index(), 1);
+    EXPECT_EQ(vx::Get<1>(first), "abc");
+
+    vx::Get<0>(vector[1]) = 8;
+    EXPECT_EQ(vector.Pool<0>()[0], 8);
+
+    const auto& view = vector;
+    EXPECT_EQ(vx::Visit([](const auto& value) { return sizeof(value); }, view[1]), sizeof(int));
+}
+
+TEST(VariantVector, VisitAll)
+{
+    namespace vx = variantx;
+    using Vector = vx::VariantVector<int, std::string>;
+
+    Vector vector;
+    vector.PushBack(1);
+    vector.PushBack(std::string("x"));
+    vector.PushBack(2);
+    vector.PushBack(std::string("y"));
+
+    std::vector<std::string> order;
+    std::as_const(vector).VisitAll(
+        [&order](const auto& value)
+        {
+            if constexpr (std::is_same_v<std::remove_cvref_t<decltype(value)>, int>)
+            {
+                order.push_back(std::to_string(value));
+            }
+            else
+            {
+                order.push_back(value);
+            }
+        });
+
+    // Pool by pool, insertion order inside a pool
+    EXPECT_EQ(order, (std::vector<std::string>{"1", "2", "x", "y"}));
+
+    vector.VisitAll([](auto& value) { value += value; });
+    EXPECT_EQ(vector.Pool<0>()[1], 4);
+    EXPECT_EQ(vx::Get<1>(vector[3]), "yy");
+}
+
+TEST(PackedVariantBuffer, OnlyWhatTheAlternativeNeeds)
+{
+    namespace vx = variantx;
+
+    struct Heartbeat
+    {
+        std::uint32_t id;
+    };
+
+    struct Report
+    {
+        std::uint64_t id;
+        double        values[32];  // NOLINT -> c-style array
+    };
+
+    using Buffer = vx::PackedVariantBuffer<Heartbeat, Report>;
+    static_assert(std::forward_iterator<Buffer::iterator>);
+    static_assert(std::forward_iterator<Buffer::const_iterator>);
+
+    Buffer buffer;
+    for (std::uint32_t i = 0; i != 100; ++i)
+    {
+        buffer.Emplace<Heartbeat>(i);
+    }
+    buffer.PushBack(vx::Variant<Heartbeat, Report>(Report{7, {1.5}}));
+
+    ASSERT_EQ(buffer.Size(), 101);
+    // A tag, padding to 4 and 4 bytes of payload per heartbeat
+    EXPECT_EQ(buffer.SizeBytes(), 100 * 8 + 8 + sizeof(Report));
+    EXPECT_LT(buffer.SizeBytes(), buffer.Size() * sizeof(vx::Variant<Heartbeat, Report>));
+
+    std::uint64_t sum = 0;
+    for (auto element : std::as_const(buffer))
+    {
+        sum += vx::Visit([](const auto& record) -> std::uint64_t { return record.id; }, element);
+    }
+    EXPECT_EQ(sum, 99 * 100 / 2 + 7);
+
+    const Buffer copy = buffer;
+    auto last         = std::next(copy.begin(), 100);
+    ASSERT_EQ(last.Index(), 1);
+    EXPECT_EQ(vx::Get<1>(*last).values[0], 1.5);
+    EXPECT_EQ(std::next(last), copy.end());
+}
+
+TEST(PackedVariantBuffer, NonTrivialAlternatives)
+{
+    namespace vx = variantx;
+    using Buffer = vx::PackedVariantBuffer<char, std::string, std::unique_ptr<int>>;
+
+    Buffer buffer;
+    buffer.Reserve(16);
+    for (int i = 0; i != 50; ++i)
+    {
+        buffer.Emplace<0>('a');
+        buffer.Emplace<std::string>(40, 'x');
+        buffer.Emplace<2>(std::make_unique<int>(i));
+    }
+    buffer.Emplace<char>('z');
+
+    ASSERT_EQ(buffer.Size(), 151);
+    EXPECT_GT(buffer.CapacityBytes(), 16);
+
+    int         sum   = 0;
+    std::size_t chars = 0;
+    buffer.VisitAll(
+        [&](auto& value)
+        {
+            using T = std::remove_cvref_t<decltype(value)>;
+            if constexpr (std::is_same_v<T, char>)
+            {
+                ++chars;
+            }
+            else if constexpr (std::is_same_v<T, std::string>)
+            {
+                EXPECT_EQ(value, std::string(40, 'x'));
+            }
+            else
+            {
+                sum += *value;
+            }
+        });
+    EXPECT_EQ(chars, 51);
+    EXPECT_EQ(sum, 49 * 50 / 2);
+
+    Buffer moved = std::move(buffer);
+    EXPECT_EQ(moved.Size(), 151);
+    EXPECT_TRUE(buffer.Empty());  // NOLINT -> use after move is specified
+
+    moved.Clear();
+    EXPECT_EQ(moved.SizeBytes(), 0);
+}
+
+TEST(PackedVariantBuffer, EmplaceFromOwnElement)
+{
+    namespace vx = variantx;
+    using Buffer = vx::PackedVariantBuffer<int, std::string>;
+
+    // Every append of a copy of the last element grows the buffer at some point
+    Buffer buffer;
+    buffer.Emplace<std::string>(100, 'x');
+    for (int i = 0; i != 100; ++i)
+    {
+        std::string* last = nullptr;
+        buffer.VisitAll(
+            [&](auto& value)
+            {
+                if constexpr (std::is_same_v<std::remove_cvref_t<decltype(value)>, std::string>)
+                {
+                    last = &value;
+                }
+            });
+        buffer.Emplace<std::string>(*last);
+    }
+
+    std::size_t strings = 0;
+    buffer.VisitAll(
+        [&](const auto& value)
+        {
+            if constexpr (std::is_same_v<std::remove_cvref_t<decltype(value)>, std::string>)
+            {
+                EXPECT_EQ(value, std::string(100, 'x'));
+                ++strings;
+            }
+        });
+    EXPECT_EQ(strings, 101);
+}
+
+TEST(VariantCollection, Segments)
+{
+    namespace vx = variantx;
+    using Collection = vx::VariantCollection<int, std::string, std::unique_ptr<double>>;
+
+    Collection collection;
+    EXPECT_TRUE(collection.Empty());
+
+    collection.Insert(1);
+    collection.Insert(std::string("a"));
+    collection.Insert(std::make_unique<double>(0.5));
+    collection.Insert(vx::Variant<int, std::string, std::unique_ptr<double>>(2));
+    collection.Emplace<std::string>(2, 'b');
+    collection.Emplace<0>(3);
+
+    ASSERT_EQ(collection.Size(), 6);
+    EXPECT_EQ(collection.Segment<int>().size(), 3);
+    EXPECT_EQ(collection.Segment<1>().size(), 2);
+    EXPECT_EQ(*collection.Segment<2>()[0], 0.5);
+
+    // Insertion order is kept inside a segment
+    const auto& ints = std::as_const(collection).Segment<int>();
+    EXPECT_EQ(std::vector<int>(ints.begin(), ints.end()), (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(collection.Segment<std::string>()[1], "bb");
+
+    collection.Clear();
+    EXPECT_TRUE(collection.Empty());
+}
+
+TEST(VariantCollection, ForEach)
+{
+    namespace vx = variantx;
+    using Collection = vx::VariantCollection<int, double>;
+
+    Collection collection;
+    collection.Reserve<int>(2);
+    collection.Insert(1);
+    collection.Insert(0.5);
+    collection.Insert(2);
+
+    collection.ForEach([](auto& value) { value *= 2; });
+
+    std::vector<double> seen;
+    std::as_const(collection).ForEach([&seen](const auto& value) { seen.push_back(value); });
+
+    // Segment after segment
+    EXPECT_EQ(seen, (std::vector<double>{2, 4, 1}));
+}
+
+TEST(PackedIndexArray, Layout)
+{
+    namespace vx = variantx;
+
+    static_assert(vx::PackedIndexArray<1>::kBits == 1);
+    static_assert(vx::PackedIndexArray<3>::kBits == 2);
+    static_assert(vx::PackedIndexArray<4>::kBits == 3);
+    static_assert(vx::PackedIndexArray<4>::kPerWord == 21);
+    static_assert(vx::PackedIndexArray<255>::kBits == 8);
+
+    vx::PackedIndexArray<4> indices;
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        indices.PushBack(i % 4);
+    }
+    indices.PushBack(vx::kVariantNpos);
+
+    ASSERT_EQ(indices.Size(), 101);
+    EXPECT_EQ(indices.Words().size(), 5);
+    EXPECT_EQ(indices[0], 0);
+    EXPECT_EQ(indices[22], 2);
+    EXPECT_EQ(indices[100], vx::kVariantNpos);
+
+    indices.Set(22, 3);
+    EXPECT_EQ(indices[21], 1);
+    EXPECT_EQ(indices[22], 3);
+    EXPECT_EQ(indices[23], 3);
+}
+
+TEST(PackedIndexArray, Scans)
+{
+    namespace vx = variantx;
+
+    std::mt19937                               rng(42);  // NOLINT -> fixed seed
+    std::uniform_int_distribution<std::size_t> pick(0, 4);
+
+    vx::PackedIndexArray<5> indices;
+    std::vector<std::size_t> plain;
+    for (std::size_t i = 0; i != 1000; ++i)
+    {
+        const std::size_t index = pick(rng);
+        indices.PushBack(index);
+        plain.push_back(index);
+    }
+
+    std::array<std::size_t, 5> expected{};
+    for (const std::size_t index : plain)
+    {
+        ++expected[index];
+    }
+
+    EXPECT_EQ(indices.Histogram(), expected);
+    EXPECT_EQ(indices.CountAlternative<0>(), expected[0]);
+    EXPECT_EQ(indices.Count(4), expected[4]);
+    EXPECT_EQ(indices.Count(vx::kVariantNpos), 0);
+
+    for (std::size_t from : {0, 1, 20, 21, 500, 999})
+    {
+        for (std::size_t index = 0; index != 5; ++index)
+        {
+            std::size_t position = from;
+            while (position < plain.size() && plain[position] != index)
+            {
+                ++position;
+            }
+            const std::size_t found = indices.FindFirst(index, from);
+            EXPECT_EQ(found, position == plain.size() ? indices.kNotFound : position);
+        }
+    }
+    EXPECT_EQ(indices.FindFirst(0, 1000), indices.kNotFound);
+
+    // Unused fields of the last word are zero, they are not taken for alternative 0
+    vx::PackedIndexArray<5> single;
+    single.PushBack(3);
+    EXPECT_EQ(single.Count(0), 0);
+    EXPECT_EQ(single.FindFirst(0), single.kNotFound);
+    EXPECT_EQ(single.Histogram()[3], 1);
+}
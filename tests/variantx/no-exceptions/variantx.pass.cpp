@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <headers/variantx.hpp>
+#include <string>
+#include <utility>
+
+// Built with -fno-exceptions
+
+static_assert(VARIANTX_HAS_EXCEPTIONS == 0);
+
+namespace
+{
+    // NOLINTBEGIN
+    struct MayThrowMove
+    {
+        explicit MayThrowMove(int value) : value(value) {}
+
+        MayThrowMove(MayThrowMove&& that) noexcept(false) : value(that.value) {}
+        MayThrowMove& operator=(MayThrowMove&& that) noexcept(false)
+        {
+            value = that.value;
+            return *this;
+        }
+
+        friend void swap(MayThrowMove& lhs, MayThrowMove& rhs) noexcept(false)
+        {
+            std::swap(lhs.value, rhs.value);
+        }
+
+        int value;
+    };
+
+    struct MayThrowConversion
+    {
+        inline static std::size_t moves = 0;
+
+        MayThrowConversion(int value) noexcept(false) : value(value) {}
+
+        MayThrowConversion(MayThrowConversion&& that) noexcept : value(that.value) { ++moves; }
+        MayThrowConversion& operator=(MayThrowConversion&& that) noexcept
+        {
+            value = that.value;
+            ++moves;
+            return *this;
+        }
+
+        int value;
+    };
+    // NOLINTEND
+
+    void PrintingHandler(const char* reason) noexcept
+    {
+        std::fprintf(stderr, "variantx: %s\n", reason);  // NOLINT -> vararg call
+    }
+}  // namespace
+
+TEST(NoExceptions, GetTerminates)
+{
+    namespace vx = variantx;
+
+    vx::Variant<int, std::string> variant(42);
+    EXPECT_EQ(vx::Get<int>(variant), 42);
+
+    EXPECT_DEATH({ [[maybe_unused]] auto& value = vx::Get<1>(variant); }, "");
+}
+
+TEST(NoExceptions, TerminateHandler)
+{
+    namespace vx = variantx;
+
+    vx::Variant<int, std::string> variant(42);
+
+    EXPECT_EQ(vx::GetTerminateHandler(), nullptr);
+    EXPECT_EQ(vx::SetTerminateHandler(PrintingHandler), nullptr);
+    EXPECT_EQ(vx::GetTerminateHandler(), &PrintingHandler);
+
+    EXPECT_DEATH({ [[maybe_unused]] auto& value = vx::Get<std::string>(variant); },
+                 "variantx: Variant does not hold this value");
+
+    EXPECT_EQ(vx::SetTerminateHandler(nullptr), &PrintingHandler);
+}
+
+TEST(NoExceptions, Swap)
+{
+    namespace vx = variantx;
+    using V      = vx::Variant<int, MayThrowMove>;
+
+    V fst(1);
+    V snd(std::in_place_type<MayThrowMove>, 2);
+
+    fst.swap(snd);
+    EXPECT_EQ(vx::Get<MayThrowMove>(fst).value, 2);
+    EXPECT_EQ(vx::Get<int>(snd), 1);
+
+    V thd(std::in_place_type<MayThrowMove>, 3);
+    fst.swap(thd);
+    EXPECT_EQ(vx::Get<MayThrowMove>(fst).value, 3);
+    EXPECT_EQ(vx::Get<MayThrowMove>(thd).value, 2);
+}
+
+TEST(NoExceptions, ConvertingAssignmentConstructsInPlace)
+{
+    namespace vx = variantx;
+
+    vx::Variant<std::string, MayThrowConversion> variant;
+
+    MayThrowConversion::moves = 0;
+    variant                   = 42;
+
+    ASSERT_EQ(variant.Index(), 1);
+    EXPECT_EQ(vx::Get<1>(variant).value, 42);
+
+    // No temporary: the strong guarantee path is not needed without exceptions
+    EXPECT_EQ(MayThrowConversion::moves, 0);
+}
+
+TEST(NoExceptions, Visit)
+{
+    namespace vx = variantx;
+
+    vx::Variant<int, std::string> variant(std::string("abc"));
+
+    const auto size = vx::Visit(
+        [](const auto& value) -> std::size_t
+        {
+            if constexpr (std::is_same_v<std::remove_cvref_t<decltype(value)>, int>)
+            {
+                return 1;
+            }
+            else
+            {
+                return value.size();
+            }
+        },
+        variant);
+
+    EXPECT_EQ(size, 3);
+}
@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <headers/variantx-pmr.hpp>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    namespace vx = variantx;
+
+    // Counts what reaches the upstream resource
+    class CountingResource : public std::pmr::memory_resource
+    {
+    public:
+        std::size_t Allocations() const noexcept { return allocations_; }
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            ++allocations_;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override
+        {
+            std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& that) const noexcept override
+        {
+            return this == &that;
+        }
+
+        std::size_t allocations_ = 0;
+    };
+
+    // Everything not allocated from an arena lands in `heap_`
+    class Arena : public ::testing::Test
+    {
+    protected:
+        void SetUp() override { previous_ = std::pmr::set_default_resource(&heap_); }
+
+        void TearDown() override { std::pmr::set_default_resource(previous_); }
+
+        std::size_t HeapAllocations() const noexcept { return heap_.Allocations(); }
+
+        std::array<std::byte, 4096>         buffer_{};
+        std::pmr::monotonic_buffer_resource arena_{buffer_.data(), buffer_.size(),
+                                                   std::pmr::null_memory_resource()};
+
+    private:
+        CountingResource           heap_;
+        std::pmr::memory_resource* previous_ = nullptr;
+    };
+
+    using Message = vx::pmr::Variant<int, std::pmr::string, std::pmr::vector<int>>;
+
+    // Longer than any small string buffer
+    constexpr const char* kLong = "a string that does not fit into the small string buffer";
+}  // namespace
+
+TEST_F(Arena, Construction)
+{
+    static_assert(std::uses_allocator_v<Message, std::pmr::polymorphic_allocator<>>);
+
+    Message text(std::allocator_arg, &arena_, kLong);
+    ASSERT_EQ(text.Index(), 1);
+    EXPECT_EQ(vx::Get<1>(text), kLong);
+    EXPECT_EQ(vx::Get<1>(text).get_allocator().resource(), &arena_);
+    EXPECT_EQ(text.GetAllocator().resource(), &arena_);
+
+    Message numbers(std::allocator_arg, &arena_, std::in_place_index<2>, 100, 7);
+    EXPECT_EQ(vx::Get<2>(numbers).size(), 100);
+    EXPECT_EQ(vx::Get<2>(numbers).get_allocator().resource(), &arena_);
+
+    Message first(std::allocator_arg, &arena_);
+    EXPECT_EQ(vx::Get<0>(first), 0);
+
+    EXPECT_EQ(HeapAllocations(), 0);
+
+    // No allocator: the default resource
+    const Message heap(kLong);
+    EXPECT_EQ(vx::Get<1>(heap).get_allocator().resource(), std::pmr::get_default_resource());
+    EXPECT_EQ(HeapAllocations(), 1);
+}
+
+TEST_F(Arena, AssignmentKeepsResource)
+{
+    Message message(std::allocator_arg, &arena_, 1);
+
+    message = kLong;
+    message.Emplace<std::pmr::vector<int>>(50, 1);
+    message.EmplaceOrAssign<1>(kLong);
+    EXPECT_EQ(vx::Get<1>(message).get_allocator().resource(), &arena_);
+
+    // Values from the default resource are copied into the arena
+    const Message heap(std::in_place_index<2>, 10, 2);
+    const std::size_t heap_allocations = HeapAllocations();
+
+    message = heap;
+    ASSERT_EQ(message.Index(), 2);
+    EXPECT_EQ(vx::Get<2>(message), vx::Get<2>(heap));
+    EXPECT_EQ(vx::Get<2>(message).get_allocator().resource(), &arena_);
+
+    Message moved(std::in_place_index<1>, kLong);
+    message = std::move(moved);
+    EXPECT_EQ(vx::Get<1>(message), kLong);
+    EXPECT_EQ(vx::Get<1>(message).get_allocator().resource(), &arena_);
+    EXPECT_EQ(message.GetAllocator().resource(), &arena_);
+
+    EXPECT_EQ(HeapAllocations(), heap_allocations + 1);
+}
+
+TEST_F(Arena, Copies)
+{
+    const Message message(std::allocator_arg, &arena_, kLong);
+
+    // As the std::pmr containers: the move constructor keeps the resource, the copy uses
+    // the default one unless given an allocator
+    Message arena_copy(std::allocator_arg, &arena_, message);
+    EXPECT_EQ(vx::Get<1>(arena_copy).get_allocator().resource(), &arena_);
+
+    const Message moved(std::move(arena_copy));
+    EXPECT_EQ(moved.GetAllocator().resource(), &arena_);
+    EXPECT_EQ(vx::Get<1>(moved).get_allocator().resource(), &arena_);
+    EXPECT_EQ(HeapAllocations(), 0);
+
+    const Message copy(message);
+    EXPECT_EQ(copy.GetAllocator().resource(), std::pmr::get_default_resource());
+    EXPECT_EQ(vx::Get<1>(copy), kLong);
+    EXPECT_EQ(HeapAllocations(), 1);
+
+    // Elements of a pmr container get the resource of the container
+    std::pmr::vector<Message> messages(&arena_);
+    messages.reserve(4);
+    messages.push_back(copy);
+    messages.emplace_back(kLong);
+    messages.emplace_back(std::in_place_index<2>, 3, 1);
+    for (const Message& element : messages)
+    {
+        EXPECT_EQ(element.GetAllocator().resource(), &arena_);
+    }
+    EXPECT_EQ(vx::Get<1>(messages[0]).get_allocator().resource(), &arena_);
+    EXPECT_EQ(HeapAllocations(), 1);
+}
+
+TEST_F(Arena, Visit)
+{
+    Message message(std::allocator_arg, &arena_, kLong);
+
+    const std::size_t size = vx::Visit(
+        [](const auto& value) -> std::size_t
+        {
+            if constexpr (std::is_same_v<std::decay_t<decltype(value)>, int>)
+            {
+                return 0;
+            }
+            else
+            {
+                return value.size();
+            }
+        },
+        message);
+    EXPECT_EQ(size, std::char_traits<char>::length(kLong));
+
+    Message other(std::allocator_arg, &arena_, 5);
+    message.swap(other);
+    EXPECT_EQ(vx::Get<0>(message), 5);
+    EXPECT_EQ(vx::Get<1>(other), kLong);
+    EXPECT_NE(message, other);
+}
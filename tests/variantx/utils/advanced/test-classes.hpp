@@ -3,6 +3,7 @@
 #include <cassert>
 #include <cstddef>
 #include <exception>
+#include <functional>
 #include <vector>
 
 // NOLINTBEGIN
@@ -375,6 +376,17 @@ namespace advanced_test
         bool operator>=(const EmptyComparable&) const { throw std::exception(); }
     };
 
+    struct EmptyComparableHashable : EmptyComparable
+    {
+    };
+
+    // With its own std::hash
+    enum class HashedKey : std::uint8_t
+    {
+        First,
+        Second
+    };
+
     struct ComparisonCounters
     {
         size_t equal         = 0;
@@ -529,5 +541,37 @@ namespace advanced_test
             throw std::exception();
         }
     };
+
+    struct ReusableBuffer
+    {
+        ReusableBuffer() = default;
+
+        explicit ReusableBuffer(std::size_t size) : data(size) {}
+
+        ReusableBuffer& operator=(std::size_t size)
+        {
+            data.assign(size, 0);
+            return *this;
+        }
+
+        void clear() { data.clear(); }
+
+        std::vector<int> data;
+    };
 }  // namespace advanced_test
+
+template <>
+struct std::hash<advanced_test::EmptyComparableHashable>
+{
+    std::size_t operator()(const advanced_test::EmptyComparableHashable&) const noexcept
+    {
+        return 0;
+    }
+};
+
+template <>
+struct std::hash<advanced_test::HashedKey>
+{
+    std::size_t operator()(advanced_test::HashedKey) const noexcept { return 42; }  // NOLINT
+};
 // NOLINTEND